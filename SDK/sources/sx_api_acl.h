@@ -538,6 +538,87 @@ sx_status_t sx_api_acl_policy_based_switching_iter_get(const sx_api_handle_t
                                                        sx_acl_pbs_id_t           *pbs_id_list_p,
                                                        uint32_t                  *pbs_id_cnt_p);
 
+/**
+ * This API adds/deletes a list of policy based switching (PBS) entries in a single call.
+ *
+ * ADD creates a PBS entry for each element of pbs_entry_list_p, as with sx_api_acl_policy_based_switching_set ADD,
+ * and returns the created PBS IDs in pbs_id_list_p.
+ * DELETE deletes the PBS entries given in pbs_id_list_p (pbs_entry_list_p is ignored and may be NULL).
+ *
+ * All elements are validated and all PBS IDs and hardware resources are reserved before any entry is written. If any
+ * element fails, no PBS entry is added or deleted, the index of the first failing element is returned in failed_idx_p,
+ * and the error of that element is returned. Hardware updates of all elements are aggregated.
+ * If a hardware write fails after some elements were written, the SDK reverts the elements already written (ADD
+ * removes the created entries, DELETE writes the deleted entries back), returns the index of the element whose write
+ * failed in failed_idx_p and returns SX_STATUS_SXD_RETURNED_NON_ZERO, as with sx_api_acl_bind_bulk_set.
+ *
+ * Note: DELETE of a PBS ID that is still used by an ACL rule fails with SX_STATUS_RESOURCE_IN_USE, as with
+ *       sx_api_acl_policy_based_switching_set.
+ *
+ * Supported devices: Spectrum, Spectrum2, Spectrum3, Spectrum4.
+ *
+ * @param[in] handle              - SX-API handle
+ * @param[in] cmd                 - ADD/DELETE
+ * @param[in] swid                - SWID of the PBS entries
+ * @param[in] pbs_entry_list_p    - List of PBS attributes
+ * @param[in,out] pbs_id_list_p   - [out] created PBS IDs (ADD)/[in] PBS IDs to delete (DELETE)
+ * @param[in] pbs_cnt             - Number of elements
+ * @param[out] failed_idx_p       - Index of the first failing element, if the operation fails (may be NULL)
+ *
+ * @return SX_STATUS_SUCCESS                                                             Operation completed successfully
+ * @return SX_STATUS_PARAM_NULL, SX_STATUS_PARAM_ERROR or SX_STATUS_PARAM_EXCEEDS_RANGE  Any input parameter is invalid
+ * @return SX_STATUS_ENTRY_NOT_FOUND                                                     PBS ID is not found in database
+ * @return SX_STATUS_NO_RESOURCES                                                        No resources are available for the operation
+ * @return SX_STATUS_RESOURCE_IN_USE                                                     PBS ID is in use by an ACL rule
+ * @return SX_STATUS_SXD_RETURNED_NON_ZERO                                               Hardware failure, written elements reverted
+ * @return SX_STATUS_CMD_UNSUPPORTED                                                     Command is unsupported
+ * @return SX_STATUS_INVALID_HANDLE                                                      Invalid handle error
+ */
+sx_status_t sx_api_acl_policy_based_switching_bulk_set(const sx_api_handle_t     handle,
+                                                       const sx_access_cmd_t     cmd,
+                                                       const sx_swid_t           swid,
+                                                       const sx_acl_pbs_entry_t *pbs_entry_list_p,
+                                                       sx_acl_pbs_id_t          *pbs_id_list_p,
+                                                       const uint32_t            pbs_cnt,
+                                                       uint32_t                 *failed_idx_p);
+
+/**
+ * This API gets a list of PBS IDs together with their PBS entries.
+ *
+ * The commands and the filter have the same semantics as in sx_api_acl_policy_based_switching_iter_get, but the
+ * number of entries per call is limited only by *pbs_id_cnt_p, and the attributes of each returned PBS ID are returned
+ * in pbs_entry_list_p in the same call.
+ *
+ * Note: As for sx_api_acl_policy_based_switching_get, the log_ports of each element of pbs_entry_list_p should be
+ *       pre-allocated and port_num should be set to the maximum number of ports to be retrieved.
+ *       If pbs_entry_list_p is NULL, only PBS IDs are returned.
+ *
+ * Supported devices: Spectrum, Spectrum2, Spectrum3, Spectrum4.
+ *
+ * @param[in] handle             - SX-API handle
+ * @param[in] cmd                - GET/GET_NEXT/GET_FIRST
+ * @param[in] swid               - SWID of the PBS entry
+ * @param[in] pbs_id_key         - PBS entry ID to use as pbs_id_key for GET and GET_NEXT commands
+ * @param[in] pbs_id_filter_p    - Filter the entries retrieved based on entry type
+ * @param[out] pbs_id_list_p     - Pointer to the list of PBS IDs returned
+ * @param[out] pbs_entry_list_p  - Pointer to the list of PBS entries returned (may be NULL)
+ * @param[in,out] pbs_id_cnt_p   - [in] number of entries to retrieve/[out] number of entries retrieved
+ *
+ * @return SX_STATUS_SUCCESS              Operation completed successfully
+ * @return SX_STATUS_PARAM_ERROR          Any parameter is in error
+ * @return SX_STATUS_CMD_UNSUPPORTED      Command is not supported
+ * @return SX_STATUS_INVALID_HANDLE       Handle is invalid
+ * @return SX_STATUS_ERROR                General error
+ */
+sx_status_t sx_api_acl_policy_based_switching_bulk_iter_get(const sx_api_handle_t      handle,
+                                                            const sx_access_cmd_t      cmd,
+                                                            const sx_swid_t            swid,
+                                                            const sx_acl_pbs_id_t      pbs_id_key,
+                                                            const sx_acl_pbs_filter_t *pbs_id_filter_p,
+                                                            sx_acl_pbs_id_t           *pbs_id_list_p,
+                                                            sx_acl_pbs_entry_t        *pbs_entry_list_p,
+                                                            uint32_t                  *pbs_id_cnt_p);
+
 /**
  * This API adds/edits/deletes a Layer 4 port range comparison set (up to SX_ACL_MAX_PORT_RANGES).
  *
@@ -685,6 +766,108 @@ sx_status_t sx_api_acl_range_get(const sx_api_handle_t        handle,
                                  const sx_acl_port_range_id_t range_id,
                                  sx_acl_range_entry_t        *range_entry_p);
 
+/**
+ * This API adds/deletes a reference to a shared range comparison set.
+ *
+ * ADD looks for an existing range with the same range comparison (range type, match type, IP header, direction and
+ * range values), whether it was created by this API, by sx_api_acl_range_set or by sx_api_acl_l4_port_range_set. If one
+ * exists, its reference count is incremented and its ID is returned in range_id_p. Otherwise, a new range is allocated
+ * as with sx_api_acl_range_set ADD, with a reference count of 1.
+ * DELETE decrements the reference count of the range given in range_id_p. A range allocated by this API is freed when
+ * the reference count reaches zero; the range must not be used by ACL rules at that time. A range created by
+ * sx_api_acl_range_set or sx_api_acl_l4_port_range_set is never freed by this API; it is owned by its creator, and
+ * EDIT/DELETE of such a range by its creator fails with SX_STATUS_RESOURCE_IN_USE while its reference count is not zero.
+ *
+ * The reference count is returned in ref_cnt_p after the operation. Shared ranges are counted against the same
+ * SX_ACL_MAX_PORT_RANGES limit as ranges created with sx_api_acl_range_set.
+ *
+ * Note: Spectrum is not supported. On Spectrum, L4 port ranges are only created by sx_api_acl_l4_port_range_set, and
+ *       they are not shared.
+ *
+ * Supported devices: Spectrum2, Spectrum3, Spectrum4.
+ *
+ * @param[in] handle          - SX-API handle
+ * @param[in] cmd             - ADD/DELETE
+ * @param[in] range_entry_p   - Range comparison (ignored on DELETE)
+ * @param[in,out] range_id_p  - Range comparison ID
+ * @param[out] ref_cnt_p      - Reference count of the range after the operation (may be NULL)
+ *
+ * @return SX_STATUS_SUCCESS                                        Operation completed successfully
+ * @return SX_STATUS_PARAM_ERROR or SX_STATUS_PARAM_EXCEEDS_RANGE   Any input parameter is invalid
+ * @return SX_STATUS_ENTRY_NOT_FOUND                                Range is not found in database
+ * @return SX_STATUS_NO_RESOURCES                                   No free range comparison set
+ * @return SX_STATUS_RESOURCE_IN_USE                                Range is in use by ACL rules and cannot be freed
+ * @return SX_STATUS_CMD_UNSUPPORTED                                Command is unsupported
+ * @return SX_STATUS_INVALID_HANDLE                                 Invalid handle error
+ */
+sx_status_t sx_api_acl_range_shared_set(const sx_api_handle_t       handle,
+                                        const sx_access_cmd_t       cmd,
+                                        const sx_acl_range_entry_t *range_entry_p,
+                                        sx_acl_port_range_id_t     *range_id_p,
+                                        uint32_t                   *ref_cnt_p);
+
+/**
+ * This API computes, for a list of range comparisons, whether each range should use a hardware range comparison set
+ * or be expanded into value/mask prefixes, and reports the TCAM cost of each choice.
+ *
+ * For each element i, rule_cnt_list_p[i] is the number of rules that use range_list_p[i]. plan_list_p[i] returns:
+ *   - The number of value/mask prefixes needed to expand the range, i.e. the number of TCAM entries each rule using
+ *     the range consumes when expanded.
+ *   - The shared range ID if an identical shared range already exists (see sx_api_acl_range_shared_set).
+ *   - The chosen method (comparator or expansion) and the total TCAM entries consumed by the chosen method.
+ * The method of each range is chosen by the following rules, in order of precedence:
+ *   1. A range that expands to a single prefix uses expansion, since it consumes one TCAM entry per rule either way and
+ *      no range comparison set. This applies also if an identical shared range exists; its ID is still reported.
+ *   2. A range that has an identical shared range uses the shared range, since it consumes no free range comparison set.
+ *   3. The free range comparison sets are assigned to the remaining ranges with the highest expansion cost
+ *      (prefix count x rule count) first. The remaining ranges use expansion.
+ *
+ * The API does not allocate any range.
+ *
+ * Supported devices: Spectrum2, Spectrum3, Spectrum4.
+ *
+ * @param[in] handle            - SX-API handle
+ * @param[in] range_list_p      - List of range comparisons
+ * @param[in] rule_cnt_list_p   - Number of rules using each range comparison
+ * @param[in] range_cnt         - Number of range comparisons
+ * @param[out] plan_list_p      - Chosen method and cost per range comparison
+ *
+ * @return SX_STATUS_SUCCESS                                        Operation completed successfully
+ * @return SX_STATUS_PARAM_NULL                                     A parameter is NULL
+ * @return SX_STATUS_PARAM_ERROR or SX_STATUS_PARAM_EXCEEDS_RANGE   Any input parameter is invalid
+ * @return SX_STATUS_INVALID_HANDLE                                 Invalid handle error
+ */
+sx_status_t sx_api_acl_range_plan_get(const sx_api_handle_t       handle,
+                                      const sx_acl_range_entry_t *range_list_p,
+                                      const uint32_t             *rule_cnt_list_p,
+                                      const uint32_t              range_cnt,
+                                      sx_acl_range_plan_t        *plan_list_p);
+
+/**
+ * This API returns the minimal list of value/mask prefixes that together match exactly the values of a range comparison.
+ * The prefixes can be used as key values and masks of the corresponding ACL key when the range is expanded.
+ *
+ * Only range types that map to a single ACL key (e.g. L4 port, IP length, TTL) can be expanded.
+ * If prefix_list_p is NULL or *prefix_cnt_p is 0, only the number of prefixes is returned.
+ * The API does not access the SDK.
+ *
+ * Supported devices: Spectrum, Spectrum2, Spectrum3, Spectrum4.
+ *
+ * @param[in] handle            - SX-API handle
+ * @param[in] range_entry_p     - Range comparison
+ * @param[out] prefix_list_p    - List of value/mask prefixes
+ * @param[in,out] prefix_cnt_p  - [in] size of prefix_list_p/[out] number of prefixes
+ *
+ * @return SX_STATUS_SUCCESS                                        Operation completed successfully
+ * @return SX_STATUS_PARAM_NULL                                     A parameter is NULL
+ * @return SX_STATUS_PARAM_ERROR or SX_STATUS_PARAM_EXCEEDS_RANGE   Any input parameter is invalid
+ * @return SX_STATUS_UNSUPPORTED                                    Range type cannot be expanded
+ */
+sx_status_t sx_api_acl_range_expansion_get(const sx_api_handle_t       handle,
+                                           const sx_acl_range_entry_t *range_entry_p,
+                                           sx_acl_range_prefix_t      *prefix_list_p,
+                                           uint32_t                   *prefix_cnt_p);
+
 /**
  * This API is used for getting and/or clearing the activity of a specific rule.
  *
@@ -710,6 +893,45 @@ sx_status_t sx_api_acl_rule_activity_get(const sx_api_handle_t      handle,
                                          const sx_acl_rule_offset_t rule_offset,
                                          boolean_t                 *activity_p);
 
+/**
+ * This API is used to read and/or clear the activity of all the rules of one or more ACL regions in a single call.
+ *
+ * The activity is returned as a packed bitmap in activity_bitmap_p. The bitmap of each region occupies
+ * ceil(region_size / 8) bytes, where region_size is the region size returned by sx_api_acl_region_get, and the bitmaps
+ * of the regions are placed consecutively in the order of region_id_list_p. Bit (offset % 8) of byte (offset / 8)
+ * of a region bitmap is set if the rule at this offset was active. Bits of offsets without a valid rule are cleared.
+ *
+ * If activity_bitmap_p is NULL or *bitmap_size_p is 0, the required bitmap size in bytes is returned in *bitmap_size_p
+ * and no activity is read or cleared. If *bitmap_size_p is non-zero but smaller than the required size,
+ * SX_STATUS_PARAM_EXCEEDS_RANGE is returned, the required size is returned in *bitmap_size_p, and no activity is read
+ * or cleared.
+ *
+ * READ_CLEAR clears the activity of all rules in the listed regions after reading it.
+ *
+ * Note: The activity of regions that are not bound is returned as zero.
+ * Note: The default action activity is not included in the bitmap (see sx_api_acl_rule_activity_get).
+ *
+ * Supported devices: Spectrum, Spectrum2, Spectrum3, Spectrum4.
+ *
+ * @param[in] handle                - SX-API handle
+ * @param[in] cmd                   - READ/READ_CLEAR
+ * @param[in] region_id_list_p      - List of ACL region IDs
+ * @param[in] region_cnt            - Number of ACL region IDs
+ * @param[out] activity_bitmap_p    - Packed rule activity bitmap, as described above
+ * @param[in,out] bitmap_size_p     - [in] size of activity_bitmap_p in bytes/[out] size of the returned bitmap in bytes
+ *
+ * @return SX_STATUS_SUCCESS                                                             Operation completed successfully
+ * @return SX_STATUS_PARAM_NULL, SX_STATUS_PARAM_ERROR or SX_STATUS_PARAM_EXCEEDS_RANGE  Any input parameter is invalid
+ * @return SX_STATUS_ENTRY_NOT_FOUND                                                     ACL region is not found in database
+ * @return SX_STATUS_SXD_RETURNED_NON_ZERO                                               Hardware failure
+ */
+sx_status_t sx_api_acl_rule_activity_bulk_get(const sx_api_handle_t     handle,
+                                              const sx_access_cmd_t     cmd,
+                                              const sx_acl_region_id_t *region_id_list_p,
+                                              const uint32_t            region_cnt,
+                                              uint8_t                  *activity_bitmap_p,
+                                              uint32_t                 *bitmap_size_p);
+
 /**
  * This API is used for moving a block of rules within an ACL region.
  * Moving is allowed before and after ACL bind. Moving a block does not affect search hits,
@@ -736,6 +958,72 @@ sx_status_t sx_api_acl_rule_block_move_set(const sx_api_handle_t      handle,
                                            const sx_acl_size_t        block_size,
                                            const sx_acl_rule_offset_t new_block_start);
 
+/**
+ * This API is used to create/destroy a shadow region for make-before-break replacement of the rules of an ACL region.
+ *
+ * CREATE allocates a new, unbound region with the same key type as region_id and with shadow_size rules, and returns
+ * its ID in shadow_region_id_p. The new rule set is then written to the shadow region with sx_api_acl_flex_rules_set
+ * (and, if needed, sx_api_acl_flex_default_action_set). Since the shadow region is not bound, writing it does not
+ * affect traffic. Once complete, the shadow region is activated with sx_api_acl_region_shadow_commit_set.
+ * DESTROY discards a shadow region that was not committed.
+ *
+ * Only one shadow region may exist per region at a time.
+ *
+ * Note: Spectrum is not supported. On Spectrum, each ACL that uses a region points to its TCAM region in a separate
+ *       hardware entry, so the ACLs cannot be switched to the shadow region in the single hardware update required by
+ *       sx_api_acl_region_shadow_commit_set.
+ *
+ * Supported devices: Spectrum2, Spectrum3, Spectrum4.
+ *
+ * @param[in] handle                 - SX-API handle
+ * @param[in] cmd                    - CREATE/DESTROY
+ * @param[in] region_id              - ACL region ID to be replaced
+ * @param[in] shadow_size            - Maximum number of rules in the shadow region (ignored on DESTROY)
+ * @param[in,out] shadow_region_id_p - Shadow ACL region ID, as described above
+ *
+ * @return SX_STATUS_SUCCESS                                                             Operation completed successfully
+ * @return SX_STATUS_PARAM_NULL, SX_STATUS_PARAM_ERROR or SX_STATUS_PARAM_EXCEEDS_RANGE  Any input parameter is invalid
+ * @return SX_STATUS_ENTRY_NOT_FOUND                                                     Region is not found in database
+ * @return SX_STATUS_ENTRY_ALREADY_EXISTS                                                Region already has a shadow region
+ * @return SX_STATUS_NO_RESOURCES                                                        No TCAM space for the shadow region
+ * @return SX_STATUS_CMD_UNSUPPORTED                                                     Command is unsupported
+ */
+sx_status_t sx_api_acl_region_shadow_set(const sx_api_handle_t     handle,
+                                         const sx_access_cmd_t     cmd,
+                                         const sx_acl_region_id_t  region_id,
+                                         const sx_acl_size_t       shadow_size,
+                                         sx_acl_region_id_t       *shadow_region_id_p);
+
+/**
+ * This API is used to atomically replace the rules of an ACL region with the rules of its shadow region.
+ *
+ * All ACLs that use region_id are switched to the TCAM entries of the shadow region in a single hardware update,
+ * so every packet is matched either by the complete old rule set or by the complete new rule set. ACL IDs, ACL group
+ * membership (see sx_api_acl_group_set) and port/VLAN group/RIF bindings are not changed.
+ *
+ * After the commit, region_id refers to the new rules, and its rule offsets and size are those of the shadow region.
+ * The shadow region ID is no longer valid. The TCAM entries of the old rules are released asynchronously once hardware
+ * lookups that may still use them have completed; until then, this space is not available for new regions.
+ *
+ * Note: Counters and policers referenced by the new rules must be allocated before the commit. Counters of the old
+ *       rules are not transferred.
+ * Note: Spectrum is not supported, see sx_api_acl_region_shadow_set.
+ *
+ * Supported devices: Spectrum2, Spectrum3, Spectrum4.
+ *
+ * @param[in] handle           - SX-API handle
+ * @param[in] region_id        - ACL region ID to be replaced
+ * @param[in] shadow_region_id - Shadow ACL region ID created by sx_api_acl_region_shadow_set
+ *
+ * @return SX_STATUS_SUCCESS                                                             Operation completed successfully
+ * @return SX_STATUS_PARAM_NULL, SX_STATUS_PARAM_ERROR or SX_STATUS_PARAM_EXCEEDS_RANGE  Any input parameter is invalid
+ * @return SX_STATUS_ENTRY_NOT_FOUND                                                     Region or shadow region is not found
+ * @return SX_STATUS_SXD_RETURNED_NON_ZERO                                               Hardware failure
+ */
+sx_status_t sx_api_acl_region_shadow_commit_set(const sx_api_handle_t    handle,
+                                                const sx_acl_region_id_t region_id,
+                                                const sx_acl_region_id_t shadow_region_id);
+
 /**
  * This API is used to bind/unbind an ACL or an ACL group to a port (or LAG).
  * Binding more than one ACL to port may be achieved by using ACL groups.
@@ -1042,6 +1330,62 @@ sx_status_t sx_api_acl_flex_key_get(const sx_api_handle_t   handle,
                                     sx_acl_key_t           *key_list_p,
                                     uint32_t               *key_count_p);
 
+/**
+ * This API returns the list of basic keys used by a set of flexible rules.
+ * The list can be used as input to sx_api_acl_flex_key_plan_get and sx_api_acl_flex_key_set.
+ *
+ * A key is returned if it appears with a non-zero mask in the key_desc_list_p of at least one rule. Keys are returned
+ * once, in ascending order. The API only inspects the given rules and does not access the SDK.
+ *
+ * Supported devices: Spectrum, Spectrum2, Spectrum3, Spectrum4.
+ *
+ * @param[in] handle                - SX-API handle
+ * @param[in] rules_list_p          - Flexible rule content description
+ * @param[in] rules_cnt             - Number of elements in array of flexible rule descriptors
+ * @param[out] key_list_p           - Array of basic key IDs
+ * @param[in,out] key_count_p       - [in] size of key_list_p/[out] number of keys used by the rules
+ *
+ * @return SX_STATUS_SUCCESS            Operation completed successfully
+ * @return SX_STATUS_PARAM_NULL         A parameter is NULL
+ * @return SX_STATUS_PARAM_ERROR        Any input parameter is invalid
+ */
+sx_status_t sx_api_acl_flex_rules_key_usage_get(const sx_api_handle_t          handle,
+                                                const sx_flex_acl_flex_rule_t *rules_list_p,
+                                                const uint32_t                 rules_cnt,
+                                                sx_acl_key_t                  *key_list_p,
+                                                uint32_t                      *key_count_p);
+
+/**
+ * This API computes, without creating a key, the hardware layout of a flexible key made of the given basic keys.
+ *
+ * The key blocks are chosen by the same algorithm as in sx_api_acl_flex_key_set, so a key created later with the same
+ * basic keys has the returned layout. plan_p returns:
+ *   - The list of hardware key blocks and their number.
+ *   - The TCAM key width, and the number of TCAM entries used by a single rule.
+ *   - The hardware size of a region of region_size rules with this key, i.e. the value that
+ *     sx_api_acl_region_hw_size_get would return for such a region.
+ *   - The number of rules with this key that fit in the TCAM space currently free.
+ *
+ * Supported devices: Spectrum, Spectrum2, Spectrum3, Spectrum4.
+ *
+ * @param[in] handle                - SX-API handle
+ * @param[in] key_list_p            - Array of basic key IDs
+ * @param[in] key_count             - Number of elements in basic key array
+ * @param[in] region_size           - Number of rules to compute the region hardware size for
+ * @param[out] plan_p               - Key block layout, width and capacity, as described above
+ *
+ * @return SX_STATUS_SUCCESS            Operation completed successfully
+ * @return SX_STATUS_PARAM_NULL         A parameter is NULL
+ * @return SX_STATUS_PARAM_ERROR        Any input parameter is invalid
+ * @return SX_STATUS_NO_RESOURCES       The keys cannot be combined into a single flexible key
+ * @return SX_STATUS_ERROR              General error
+ */
+sx_status_t sx_api_acl_flex_key_plan_get(const sx_api_handle_t   handle,
+                                         const sx_acl_key_t     *key_list_p,
+                                         const uint32_t          key_count,
+                                         const sx_acl_size_t     region_size,
+                                         sx_acl_flex_key_plan_t *plan_p);
+
 
 /**
  * This API is used to add or remove an ACL rule from an ACL region. The user is responsible for memory management.
@@ -1132,6 +1476,94 @@ sx_status_t sx_api_acl_flex_rules_get(const sx_api_handle_t    handle,
                                       sx_flex_acl_flex_rule_t *rules_list_p,
                                       uint32_t               * rules_cnt_p);
 
+/**
+ * This API is used to synchronize the rules of an ACL region with a desired rule list.
+ *
+ * offsets_list_p and rules_list_p describe the complete desired content of the region. The SDK compares each desired
+ * rule with the rule currently set at the same offset, and:
+ *   - writes the rules at offsets where the rule content differs or where no rule is set,
+ *   - leaves unchanged the rules whose content is identical,
+ *   - deletes the rules at offsets that are not in offsets_list_p.
+ * A hash of the rule keys, masks and actions is kept for each offset and is used only as a prefilter: a rule whose
+ * hash differs is written without further comparison, and a rule whose hash matches is compared by its full key,
+ * mask, action and priority content, and is written if any of them differs. Thus a hash collision never leaves a
+ * changed rule unwritten.
+ * Only changed offsets are written to the hardware. The number of written, unchanged and deleted rules is returned in
+ * sync_cnt_p.
+ *
+ * Note: This API cannot be used on a region with managed placement enabled (see sx_api_acl_region_placement_set),
+ *       since the offsets of such a region are allocated by the SDK. SX_STATUS_CMD_UNPERMITTED is returned in that case
+ *       and the region is not changed.
+ *
+ * The same initialization and rule content restrictions as in sx_api_acl_flex_rules_set apply.
+ * Rules are written in the same way as with sx_api_acl_flex_rules_set (SET/DELETE per offset), so the update is not
+ * atomic. Use sx_api_acl_region_shadow_set for atomic replacement of a region.
+ *
+ * Supported devices: Spectrum, Spectrum2, Spectrum3, Spectrum4.
+ *
+ * @param[in] handle          - SX-API handle
+ * @param[in] region_id       - ACL region ID received during region creation
+ * @param[in] offsets_list_p  - Array of rule offsets of the desired rules
+ * @param[in] rules_list_p    - Flexible rule content description of the desired rules
+ * @param[in] rules_cnt       - Number of desired rules
+ * @param[out] sync_cnt_p     - Number of written/unchanged/deleted rules (may be NULL)
+ *
+ *  @return SX_STATUS_SUCCESS           Operation completed successfully
+ *  @return SX_STATUS_PARAM_ERROR       Invalid parameter
+ *  @return SX_STATUS_ENTRY_NOT_FOUND   Wrong region ID
+ *  @return SX_STATUS_NO_RESOURCES      Cannot allocate space for all actions
+ *  @return SX_STATUS_CMD_UNPERMITTED   Managed placement is enabled on the region
+ *
+ */
+sx_status_t sx_api_acl_flex_rules_sync_set(const sx_api_handle_t          handle,
+                                           const sx_acl_region_id_t       region_id,
+                                           const sx_acl_rule_offset_t    *offsets_list_p,
+                                           const sx_flex_acl_flex_rule_t *rules_list_p,
+                                           const uint32_t                 rules_cnt,
+                                           sx_acl_rules_sync_cnt_t       *sync_cnt_p);
+
+/**
+ * This API checks whether a list of rules can be written to an ACL region, without writing them.
+ *
+ * The rules are validated as with sx_api_acl_flex_rules_set SET, and the resources they would consume are computed
+ * and returned in report_p:
+ *   - The number of TCAM entries consumed, according to the region key width (see sx_api_acl_region_hw_size_get).
+ *   - The number of action sets (KVD entries) consumed by rules with more actions than fit in the TCAM entry.
+ *   - The number of free offsets in the region after the rules would be written, and the free ACL TCAM and action
+ *     set space in the device (as reported by the resource manager).
+ *   - Whether all rules fit, and if not, the index in rules_list_p of the first rule that would fail, and the reason.
+ * Rules replacing existing rules at the same offset are accounted for as replacements.
+ *
+ * Note: Rules can only reference range comparison IDs already allocated with sx_api_acl_range_set or
+ *       sx_api_acl_range_shared_set, so the rules consume no range comparison sets and none are reported. Rules whose
+ *       range comparisons are to be expanded into value/mask prefixes should be passed already expanded; planning of
+ *       range expansion is out of scope of this API (see sx_api_acl_range_plan_get).
+ *
+ * Nothing is committed and no resources are reserved; the result may change if other configuration is done before
+ * the rules are written.
+ *
+ * Supported devices: Spectrum, Spectrum2, Spectrum3, Spectrum4.
+ *
+ * @param[in] handle          - SX-API handle
+ * @param[in] region_id       - ACL region ID received during region creation
+ * @param[in] offsets_list_p  - Array of rule offsets
+ * @param[in] rules_list_p    - Flexible rule content description
+ * @param[in] rules_cnt       - Number of elements in array of flexible rule descriptors
+ * @param[out] report_p       - Resource consumption and fit report, as described above
+ *
+ *  @return SX_STATUS_SUCCESS           Operation completed successfully (also when the rules would not fit)
+ *  @return SX_STATUS_PARAM_NULL        A parameter is NULL
+ *  @return SX_STATUS_PARAM_ERROR       Invalid parameter (invalid rule content)
+ *  @return SX_STATUS_ENTRY_NOT_FOUND   Wrong region ID
+ *
+ */
+sx_status_t sx_api_acl_flex_rules_dry_run_get(const sx_api_handle_t          handle,
+                                              const sx_acl_region_id_t       region_id,
+                                              const sx_acl_rule_offset_t    *offsets_list_p,
+                                              const sx_flex_acl_flex_rule_t *rules_list_p,
+                                              const uint32_t                 rules_cnt,
+                                              sx_acl_rules_dry_run_report_t *report_p);
+
 
 /**
  * This API is used to bind/unbind an ACL or an ACL group to a RIF.
@@ -1216,6 +1648,61 @@ sx_status_t sx_api_acl_rif_bindings_get(const sx_api_handle_t    handle,
                                         sx_acl_id_t             *acl_id_p,
                                         uint32_t                *acl_cnt_p);
 
+/**
+ * This API is used to bind/unbind ACLs or ACL groups to/from a list of ports, LAGs, RIFs and VLAN groups in a single
+ * all-or-nothing operation.
+ *
+ * Each element of bind_list_p holds a bind object (type and ID of a logical port, LAG, RIF or VLAN group), the ACL or
+ * ACL group ID, and, for EDIT, the previously bound ACL group ID.
+ * BIND, UNBIND, ADD and DELETE have the same semantics as in sx_api_acl_port_bind_set, sx_api_acl_rif_bind_set and
+ * sx_api_acl_vlan_group_bind_set, applied to every element:
+ *   - BIND/UNBIND bind or clear the binding of a single ACL or ACL group.
+ *   - ADD/DELETE add or remove an ACL group to/from the groups bound to the object. The bound groups are executed in
+ *     the order of their group priority, set by sx_api_acl_group_attributes_set.
+ * EDIT is specific to this API. It replaces the bound ACL group prev_acl_id of the object with the ACL group acl_id,
+ * as a DELETE of prev_acl_id and an ADD of acl_id done in a single hardware update, so that the object is never left
+ * without one of the two groups. acl_id is placed among the bound groups according to its own group priority, as
+ * with ADD; the priority of prev_acl_id is not inherited. To keep the position of the replaced group, the user should
+ * set acl_id to the same group priority before calling the API. EDIT supports ACL groups only, and prev_acl_id must be
+ * bound to the object.
+ *
+ * All elements are validated and all hardware resources are reserved before any binding is changed. If any element
+ * fails, no binding is changed, the index of the first failing element is returned in failed_idx_p, and the error of
+ * that element is returned. On success, the bindings of all objects are updated together, so that traffic does not
+ * run with a mix of old and new bindings for longer than a single hardware update.
+ *
+ * If a hardware write fails while the bindings are applied, after some objects were already rebound, the SDK restores
+ * the previous bindings of those objects, returns the index of the element whose write failed in failed_idx_p and
+ * returns SX_STATUS_SXD_RETURNED_NON_ZERO. If restoring a previous binding also fails, SX_STATUS_ERROR is returned and
+ * the bindings of the listed objects are undefined; the user should read them back with the per-object get APIs
+ * (e.g. sx_api_acl_port_bind_get) and set them again.
+ *
+ * Note: The same restrictions as in the per-object bind APIs apply (e.g. MULTI_POINTS ACLs must be bound through
+ *       an ACL group).
+ * Note: An object may appear only once in bind_list_p.
+ *
+ * Supported devices: Spectrum, Spectrum2, Spectrum3, Spectrum4.
+ *
+ * @param[in] handle          - SX-API handle
+ * @param[in] cmd             - BIND/UNBIND/ADD/DELETE/EDIT
+ * @param[in] bind_list_p     - List of bind objects and ACL IDs
+ * @param[in] bind_cnt        - Number of elements in bind_list_p
+ * @param[out] failed_idx_p   - Index of the first failing element, if the operation fails (may be NULL)
+ *
+ * @return SX_STATUS_SUCCESS                                                             Operation completed successfully
+ * @return SX_STATUS_PARAM_NULL, SX_STATUS_PARAM_ERROR or SX_STATUS_PARAM_EXCEEDS_RANGE  Any input parameter is invalid
+ * @return SX_STATUS_ENTRY_NOT_FOUND                                                     ACL ID or bind object is not found in database
+ * @return SX_STATUS_NO_RESOURCES                                                        No resources are available for the operation
+ * @return SX_STATUS_SXD_RETURNED_NON_ZERO                                               Hardware failure, previous bindings restored
+ * @return SX_STATUS_ERROR                                                               Hardware failure, restore failed
+ * @return SX_STATUS_CMD_UNSUPPORTED                                                     Command is unsupported
+ */
+sx_status_t sx_api_acl_bind_bulk_set(const sx_api_handle_t      handle,
+                                     const sx_access_cmd_t      cmd,
+                                     const sx_acl_bind_entry_t *bind_list_p,
+                                     const uint32_t             bind_cnt,
+                                     uint32_t                  *failed_idx_p);
+
 /**
  * Upon ACL module initialization, the parallel ACL search type can be chosen. This API is used to support this feature by
  * linking one ACL group to another. Their relation could be described as "one directional linked list" where the second
@@ -1445,6 +1932,45 @@ sx_status_t sx_api_acl_policy_based_ilm_get(const sx_api_handle_t   handle,
                                             const sx_acl_pbilm_id_t pbilm_id,
                                             sx_acl_pbilm_entry_t   *pbilm_entry_p);
 
+/**
+ * This API creates/destroys a list of policy based ILM (PBILM) entries in a single call.
+ *
+ * CREATE creates a PBILM entry for each element of pbilm_entry_list_p, as with sx_api_acl_policy_based_ilm_set CREATE,
+ * and returns the created PBILM IDs in pbilm_id_list_p.
+ * DESTROY removes the PBILM entries given in pbilm_id_list_p (pbilm_entry_list_p is ignored and may be NULL).
+ *
+ * All elements are validated and all PBILM IDs and hardware resources are reserved before any entry is written. If any
+ * element fails, no PBILM entry is created or destroyed, the index of the first failing element is returned in
+ * failed_idx_p, and the error of that element is returned. A hardware write failure is reverted and reported as in
+ * sx_api_acl_policy_based_switching_bulk_set.
+ *
+ * Note: DESTROY of a PBILM ID that is still used by an ACL rule fails with SX_STATUS_RESOURCE_IN_USE.
+ *
+ * Supported devices: Spectrum, Spectrum2, Spectrum3, Spectrum4.
+ *
+ * @param[in] handle                - SX-API handle
+ * @param[in] cmd                   - CREATE/DESTROY
+ * @param[in] pbilm_entry_list_p    - List of PBILM attributes
+ * @param[in,out] pbilm_id_list_p   - [out] created PBILM IDs (CREATE)/[in] PBILM IDs to destroy (DESTROY)
+ * @param[in] pbilm_cnt             - Number of elements
+ * @param[out] failed_idx_p         - Index of the first failing element, if the operation fails (may be NULL)
+ *
+ * @return SX_STATUS_SUCCESS                                  Operation completed successfully
+ * @return SX_STATUS_PARAM_NULL or SX_STATUS_PARAM_ERROR      Input parameter is invalid
+ * @return SX_STATUS_ENTRY_NOT_FOUND                          PBILM ID is not found in database
+ * @return SX_STATUS_NO_RESOURCES                             No resources are available for the operation
+ * @return SX_STATUS_RESOURCE_IN_USE                          PBILM ID is in use by an ACL rule
+ * @return SX_STATUS_SXD_RETURNED_NON_ZERO                    Hardware failure, written elements reverted
+ * @return SX_STATUS_CMD_UNSUPPORTED                          Command is unsupported
+ * @return SX_STATUS_INVALID_HANDLE                           Invalid handle error
+ */
+sx_status_t sx_api_acl_policy_based_ilm_bulk_set(const sx_api_handle_t       handle,
+                                                 const sx_access_cmd_t       cmd,
+                                                 const sx_acl_pbilm_entry_t *pbilm_entry_list_p,
+                                                 sx_acl_pbilm_id_t          *pbilm_id_list_p,
+                                                 const uint32_t              pbilm_cnt,
+                                                 uint32_t                   *failed_idx_p);
+
 /**
  * This API is used for updating a set of priorities in the range (min_priority to max_priority) to priority + priority_change.
  *
@@ -1469,6 +1995,119 @@ sx_status_t sx_api_acl_flex_rules_priority_set(const sx_api_handle_t
                                                const sx_flex_acl_rule_priority_t max_priority,
                                                const int32_t                     priority_change);
 
+/**
+ * This API is used to enable/disable managed rule placement for an ACL region.
+ *
+ * On the supported devices, the match order of the rules of a region is set by the rule priority field
+ * (sx_flex_acl_flex_rule_t.priority) and not by the rule offset. With managed placement, the user gives each rule a
+ * logical priority and the SDK manages the hardware priority values of the region:
+ *   - Rules are matched in descending logical priority. Rules with an equal logical priority are matched in the order
+ *     in which they were added.
+ *   - Each rule is assigned a hardware priority value that keeps this order. Free values are kept between the values
+ *     in use, so that a new rule can usually be assigned a value between its neighbours.
+ *   - When there is no free value between the neighbours of a new rule, the SDK renumbers the hardware priorities of
+ *     the smallest possible range of existing rules, in the same way as sx_api_acl_flex_rules_priority_set.
+ *     Renumbering does not change the match order or the offsets of the renumbered rules.
+ * Offsets are only rule handles: the SDK allocates a free offset for each added rule, and an offset does not change
+ * for the lifetime of the rule.
+ *
+ * SET enables managed placement with the given attributes, or updates the attributes if it is already enabled:
+ *   - gap_percent         - Percentage of the hardware priority value space kept free between the values in use.
+ *   - rebalance_enable    - Enables incremental background renumbering, which restores the free values between
+ *                           rules after insertions consumed them.
+ *   - rebalance_max_rules - Maximum number of rules renumbered by a single background step.
+ *   - rebalance_interval  - Interval between background steps, in milliseconds.
+ * UNSET disables managed placement. Rules keep their current hardware priorities, which become the rule priorities
+ * seen by sx_api_acl_flex_rules_get.
+ *
+ * Managed placement can only be enabled on an empty region. When it is enabled, rules should be written with
+ * sx_api_acl_flex_rules_priority_based_set, and the region should not be modified with sx_api_acl_flex_rules_set,
+ * sx_api_acl_rule_block_move_set or sx_api_acl_flex_rules_priority_set. sx_api_acl_flex_rules_sync_set is rejected on
+ * such a region. sx_api_acl_flex_rules_get returns the logical priority of the rules.
+ *
+ * Note: Spectrum is not supported, since on Spectrum the match order is set by the rule offset.
+ *
+ * Supported devices: Spectrum2, Spectrum3, Spectrum4.
+ *
+ * @param[in] handle      - SX-API handle
+ * @param[in] cmd         - SET/UNSET
+ * @param[in] region_id   - ACL region ID
+ * @param[in] attr_p      - Placement attributes (ignored on UNSET)
+ *
+ * @return SX_STATUS_SUCCESS                                                             Operation completed successfully
+ * @return SX_STATUS_PARAM_NULL, SX_STATUS_PARAM_ERROR or SX_STATUS_PARAM_EXCEEDS_RANGE  Any input parameter is invalid
+ * @return SX_STATUS_ENTRY_NOT_FOUND                                                     Region is not found in database
+ * @return SX_STATUS_RESOURCE_IN_USE                                                     Region is not empty (enabling placement)
+ * @return SX_STATUS_CMD_UNSUPPORTED                                                     Command is unsupported
+ */
+sx_status_t sx_api_acl_region_placement_set(const sx_api_handle_t          handle,
+                                            const sx_access_cmd_t          cmd,
+                                            const sx_acl_region_id_t       region_id,
+                                            const sx_acl_placement_attr_t *attr_p);
+
+/**
+ * This API is used to add or remove ACL rules of a region with managed placement, by logical priority.
+ *
+ * SET adds rules. rules_list_p[i].priority is the logical priority of the rule, as described in
+ * sx_api_acl_region_placement_set. The SDK allocates a free offset for each rule, returns it in offsets_list_p, and
+ * assigns the rule a hardware priority value, renumbering existing rules only if no free value is left between the
+ * neighbours of the rule.
+ * DELETE removes the rules at the offsets given in offsets_list_p (rules_list_p is ignored). Deleting rules does not
+ * renumber other rules.
+ *
+ * The offsets of existing rules never change, neither by this API nor by background renumbering.
+ *
+ * The same rule content restrictions as in sx_api_acl_flex_rules_set apply.
+ *
+ * Supported devices: Spectrum2, Spectrum3, Spectrum4.
+ *
+ * @param[in] handle              - SX-API handle
+ * @param[in] cmd                 - SET/DELETE
+ * @param[in] region_id           - ACL region ID with managed placement enabled
+ * @param[in,out] offsets_list_p  - [out] offsets chosen for added rules/[in] offsets of rules to delete
+ * @param[in] rules_list_p        - Flexible rule content description (including the logical priority)
+ * @param[in] rules_cnt           - Number of rules
+ * @param[out] moves_cnt_p        - Number of existing rules renumbered to complete the operation (may be NULL)
+ *
+ * @return SX_STATUS_SUCCESS                                                             Operation completed successfully
+ * @return SX_STATUS_PARAM_NULL, SX_STATUS_PARAM_ERROR or SX_STATUS_PARAM_EXCEEDS_RANGE  Any input parameter is invalid
+ * @return SX_STATUS_ENTRY_NOT_FOUND                                                     Region is not found in database
+ * @return SX_STATUS_NO_RESOURCES                                                        No more space for rules in the region
+ *                                                                                       or no more hardware priority values
+ * @return SX_STATUS_CMD_UNSUPPORTED                                                     Command is unsupported
+ */
+sx_status_t sx_api_acl_flex_rules_priority_based_set(const sx_api_handle_t          handle,
+                                                     const sx_access_cmd_t          cmd,
+                                                     const sx_acl_region_id_t       region_id,
+                                                     sx_acl_rule_offset_t          *offsets_list_p,
+                                                     const sx_flex_acl_flex_rule_t *rules_list_p,
+                                                     const uint32_t                 rules_cnt,
+                                                     uint32_t                      *moves_cnt_p);
+
+/**
+ * This API is used to get the managed placement statistics of an ACL region.
+ *
+ * The statistics include the number of rules added and deleted, the total and maximum number of rules renumbered
+ * per operation, the number of rules renumbered in the background, the current number of free offsets, and the
+ * smallest number of free hardware priority values between two adjacent rules of the region.
+ *
+ * Supported devices: Spectrum2, Spectrum3, Spectrum4.
+ *
+ * @param[in] handle      - SX-API handle
+ * @param[in] cmd         - READ/READ_CLEAR (clears the accumulated counters)
+ * @param[in] region_id   - ACL region ID
+ * @param[out] stats_p    - Placement statistics
+ *
+ * @return SX_STATUS_SUCCESS                                                             Operation completed successfully
+ * @return SX_STATUS_PARAM_NULL, SX_STATUS_PARAM_ERROR or SX_STATUS_PARAM_EXCEEDS_RANGE  Any input parameter is invalid
+ * @return SX_STATUS_ENTRY_NOT_FOUND                                                     Region is not found or placement is not enabled
+ * @return SX_STATUS_CMD_UNSUPPORTED                                                     Command is unsupported
+ */
+sx_status_t sx_api_acl_region_placement_stats_get(const sx_api_handle_t     handle,
+                                                  const sx_access_cmd_t     cmd,
+                                                  const sx_acl_region_id_t  region_id,
+                                                  sx_acl_placement_stats_t *stats_p);
+
 /**
  * This API triggers a notification of ACL rules activity.
  * The application can listen for the SX_TRAP_ID_ACL_ACTIVITY Trap to get the data.
@@ -80,6 +80,7 @@ sx_status_t sx_api_bulk_counter_log_verbosity_level_get(const sx_api_handle_t
  *                           For flow counters: range of flow counter IDs.
  *                           For elephant detected flows: a list of logical port IDs.
  *                           For stateful DB: number of stateful entries, partition ID and filtering options.
+ *                           For ACL rule counters: list of ACL region IDs or an ACL/ACL group ID.
  *                           When cmd is DESTROY, key is ignored and can be NULL.
  * @param[in,out] buffer_p - On CREATE, returned allocated buffer to be used by other APIs.
  *                           On DESTROY, the buffer to deallocate.
@@ -98,6 +99,68 @@ sx_status_t sx_api_bulk_counter_buffer_set(const sx_api_handle_t            hand
                                            const sx_bulk_cntr_buffer_key_t *key_p,
                                            sx_bulk_cntr_buffer_t           *buffer_p);
 
+/**
+ * This API sets the read mode attributes of a bulk-counter-read buffer.
+ *
+ * attr_p->read_mode selects the values stored in the buffer on completion of a READ/READ_FLUSH operation:
+ *   - ABSOLUTE (default) - The counter values read from the hardware.
+ *   - DELTA              - The difference between the counter values and the values of the previous read of this
+ *                          buffer. The first read after the mode is set returns zero deltas and only sets the
+ *                          baseline.
+ * Since the baseline is kept per buffer and the hardware counters are not cleared, several consumers can each use
+ * their own DELTA buffer on the same counters, unlike with READ_CLEAR.
+ *
+ * If attr_p->rate_enable is TRUE, the SDK also computes a per-counter rate (per second) on each read, using the
+ * hardware timestamps of the current and previous reads, smoothed by an exponentially weighted moving average with
+ * weight attr_p->rate_ewma_weight (0 for the instantaneous rate). Rates are read with
+ * sx_api_bulk_counter_transaction_rate_get.
+ *
+ * DELTA and rate computation are supported only for buffers of port counter, flow counter and ACL rule counter
+ * (SX_BULK_CNTR_KEY_TYPE_ACL_RULE_E) keys, whose counters only increase until cleared. For buffers of any other key
+ * type, SX_STATUS_PARAM_ERROR is returned.
+ *
+ * No wrap-around is assumed. If a counter is lower than its baseline (e.g. it was cleared by another user with
+ * READ_CLEAR or with a clear API), the SDK reports a zero delta for it, takes the current value as the new baseline,
+ * and flags the counter as re-baselined in its counter data. The rate of such a counter is not updated on that read.
+ *
+ * Note: The attributes can be set only when no operation is running on the buffer. Setting them resets the baseline.
+ * Note: READ_CLEAR operations are not supported on buffers in DELTA mode.
+ *
+ * Supported devices: Spectrum, Spectrum2, Spectrum3, Spectrum4.
+ *
+ * @param[in] handle      - SX-API handle
+ * @param[in] buffer_p    - Valid buffer which was allocated by sx_api_bulk_counter_buffer_set()
+ * @param[in] attr_p      - Buffer read mode attributes
+ *
+ * @return SX_STATUS_SUCCESS             Operation completed successfully
+ * @return SX_STATUS_INVALID_HANDLE      NULL handle is received
+ * @return SX_STATUS_PARAM_NULL          Parameter is NULL
+ * @return SX_STATUS_PARAM_ERROR         Parameter error or buffer key type is not supported
+ * @return SX_STATUS_RESOURCE_IN_USE     Buffer operation is running
+ * @return SX_STATUS_ERROR               Operation failed
+ */
+sx_status_t sx_api_bulk_counter_buffer_attr_set(const sx_api_handle_t             handle,
+                                                const sx_bulk_cntr_buffer_t      *buffer_p,
+                                                const sx_bulk_cntr_buffer_attr_t *attr_p);
+
+/**
+ * This API gets the read mode attributes of a bulk-counter-read buffer.
+ *
+ * Supported devices: Spectrum, Spectrum2, Spectrum3, Spectrum4.
+ *
+ * @param[in] handle      - SX-API handle
+ * @param[in] buffer_p    - Valid buffer which was allocated by sx_api_bulk_counter_buffer_set()
+ * @param[out] attr_p     - Buffer read mode attributes
+ *
+ * @return SX_STATUS_SUCCESS             Operation completed successfully
+ * @return SX_STATUS_INVALID_HANDLE      NULL handle is received
+ * @return SX_STATUS_PARAM_NULL          Parameter is NULL
+ * @return SX_STATUS_ERROR               Operation failed
+ */
+sx_status_t sx_api_bulk_counter_buffer_attr_get(const sx_api_handle_t        handle,
+                                                const sx_bulk_cntr_buffer_t *buffer_p,
+                                                sx_bulk_cntr_buffer_attr_t  *attr_p);
+
 /**
  * This API initiates or cancels an asynchronous bulk-counter-read operation.
  *
@@ -106,8 +169,8 @@ sx_status_t sx_api_bulk_counter_buffer_set(const sx_api_handle_t            hand
  * CLEAR      clears a set of counters (supported only for SX_BULK_CNTR_KEY_TYPE_STATEFUL_DB_E).
  * READ_NEXT  reads next set of counters (supported only for SX_BULK_CNTR_KEY_TYPE_STATEFUL_DB_E).
  * READ_CLEAR_NEXT  reads and clears next set of counters (supported only for SX_BULK_CNTR_KEY_TYPE_STATEFUL_DB_E).
- * READ_FLUSH flushes and reads a set of counters (supported only for SX_BULK_CNTR_KEY_TYPE_FLOW_E).
- * READ_CLEAR_FLUSH flushes, reads, and clears a set of counters (supported only for SX_BULK_CNTR_KEY_TYPE_FLOW_E).
+ * READ_FLUSH flushes and reads a set of counters (supported only for SX_BULK_CNTR_KEY_TYPE_FLOW_E and SX_BULK_CNTR_KEY_TYPE_ACL_RULE_E).
+ * READ_CLEAR_FLUSH flushes, reads, and clears a set of counters (supported only for SX_BULK_CNTR_KEY_TYPE_FLOW_E and SX_BULK_CNTR_KEY_TYPE_ACL_RULE_E).
  * DISABLE cancels an active operation.
  *
  * Note: In "Normal" operation the SDK reads immediate value of the counter that can be different from its final value.
@@ -125,6 +188,10 @@ sx_status_t sx_api_bulk_counter_buffer_set(const sx_api_handle_t            hand
  *  Any change to the LAG port or to its members during the operation will not be reflected when reading the LAG counters
  *  upon operation completion.
  * Note: elephant-detected-flow-read does not support LAG ports.
+ * Note: For SX_BULK_CNTR_KEY_TYPE_ACL_RULE_E, the set of counters is determined on operation initiation: all flow counters
+ *  bound (SX_FLEX_ACL_ACTION_COUNTER) to the rules of the key regions, or of all regions of the key ACL/ACL group. Counters
+ *  of rules added or changed during the operation are not reflected. The counters are read in a single DMA transaction
+ *  and are stored in the buffer indexed by region ID and rule offset. Rules without a counter are skipped.
  * Note: shared buffer key with type SX_BULK_CNTR_SHARED_BUFFER_SNAPSHOT_E should be used after calling
  * the API sx_api_cos_sb_snapshot_action_set with action SX_SB_SNAPSHOT_ACTION_TAKE_E.
  * Note: Upon disable, the buffer cannot be used on another operation or freed until the SW_BULK_READ_DONE event is received.
@@ -134,6 +201,7 @@ sx_status_t sx_api_bulk_counter_buffer_set(const sx_api_handle_t            hand
  *           c. The refresh transaction (consumed by calling sx_api_bulk_counter_refresh_set) and any of the bulk counter types.
  *           d. 2 x SX_BULK_CNTR_KEY_TYPE_FLOW_E only if one of transactions is started for
  *              accumulated (SX_FLOW_COUNTER_TYPE_ACCUMULATED) counters and the second one for any other type of flow counters.
+ *           SX_BULK_CNTR_KEY_TYPE_ACL_RULE_E transactions are counted as SX_BULK_CNTR_KEY_TYPE_FLOW_E transactions.
  * Supported devices: Spectrum, Spectrum2, Spectrum3, Spectrum4.
  *
  * @param[in] handle      - SX-API handle
@@ -153,6 +221,56 @@ sx_status_t sx_api_bulk_counter_transaction_set(const sx_api_handle_t        han
                                                 const sx_access_cmd_t        cmd,
                                                 const sx_bulk_cntr_buffer_t *buffer_p);
 
+/**
+ * This API queues or cancels an asynchronous bulk-counter-read operation through the bulk-counter scheduler.
+ *
+ * Unlike sx_api_bulk_counter_transaction_set, this API does not fail with SX_STATUS_RESOURCE_IN_USE when the hardware
+ * transactions are busy. The operation is added to a queue and started by the SDK when a transaction that can run it
+ * becomes free (see the parallel transaction rules in sx_api_bulk_counter_transaction_set):
+ *   - Queued operations are started in order of attr_p->priority, and in order of submission for equal priority.
+ *   - Queued port-counter operations with the same cmd are merged into a single hardware transaction when their
+ *     port/counter sets allow it. Each buffer is still filled with its own counters only.
+ *   - A refresh requested by sx_api_bulk_counter_refresh_set takes precedence over queued operations.
+ * Each operation completes with its own SX_BULK_READ_DONE event, carrying its buffer ID and cookie, and the buffer is
+ * read with sx_api_bulk_counter_transaction_get as usual.
+ *
+ * DISABLE removes a queued operation from the queue, or cancels it if it has already started. In both cases an
+ * SX_BULK_READ_DONE event with status canceled is sent.
+ *
+ * The scheduler shares the hardware transactions with sx_api_bulk_counter_transaction_set and
+ * sx_api_bulk_counter_refresh_set callers:
+ *   - The scheduler runs at most one transaction at a time, so one of the two parallel transactions is always left
+ *     to direct callers. A direct call returns SX_STATUS_RESOURCE_IN_USE only if it cannot run next to the other
+ *     transactions in flight (including the scheduler transaction) by the parallel transaction rules, as before.
+ *   - Transactions in flight are never preempted. The scheduler does not cancel or delay a direct transaction, and
+ *     a direct call does not cancel a scheduler transaction; queued operations are started when the scheduler
+ *     transaction completes and the parallel transaction rules allow it.
+ *   - Direct calls are not queued and do not change the order of queued operations.
+ *
+ * Note: A buffer can be queued only once at a time.
+ * Note: If the queue is full (SX_BULK_CNTR_SCHED_QUEUE_SIZE operations), SX_STATUS_NO_RESOURCES is returned.
+ *
+ * Supported devices: Spectrum, Spectrum2, Spectrum3, Spectrum4.
+ *
+ * @param[in] handle      - SX-API handle
+ * @param[in] cmd         - READ/READ_CLEAR/READ_FLUSH/READ_CLEAR_FLUSH/DISABLE
+ * @param[in] buffer_p    - Valid buffer which was allocated by sx_api_bulk_counter_buffer_set()
+ * @param[in] attr_p      - Scheduling attributes (priority). Ignored on DISABLE, may be NULL for default priority.
+ *
+ * @return SX_STATUS_SUCCESS             Operation queued successfully
+ * @return SX_STATUS_INVALID_HANDLE      NULL handle is received
+ * @return SX_STATUS_PARAM_NULL          Parameter is NULL
+ * @return SX_STATUS_PARAM_ERROR         Parameter error
+ * @return SX_STATUS_CMD_UNSUPPORTED     Invalid command
+ * @return SX_STATUS_NO_RESOURCES        Scheduler queue is full
+ * @return SX_STATUS_RESOURCE_IN_USE     Buffer is already queued or in-flight
+ * @return SX_STATUS_ERROR               Operation failed
+ */
+sx_status_t sx_api_bulk_counter_transaction_queue_set(const sx_api_handle_t            handle,
+                                                      const sx_access_cmd_t            cmd,
+                                                      const sx_bulk_cntr_buffer_t     *buffer_p,
+                                                      const sx_bulk_cntr_sched_attr_t *attr_p);
+
 /**
  *  This API reads a single counter from a bulk-counter-read buffer.
  *
@@ -164,6 +282,7 @@ sx_status_t sx_api_bulk_counter_transaction_set(const sx_api_handle_t        han
  *                              For flow counter: Counter ID
  *                              For elephant detected flows: Logical port ID, flow ID (optional).
  *                              For stateful DB: Entry index to read
+ *                              For ACL rule counters: ACL region ID and rule offset
  * @param[in] buffer_p        - Valid buffer which was allocated by API sx_api_bulk_buffer_set()
  * @param[out] counter_data_p - Requested counter data
  *
@@ -178,6 +297,82 @@ sx_status_t sx_api_bulk_counter_transaction_get(const sx_api_handle_t          h
                                                 const sx_bulk_cntr_buffer_t   *buffer_p,
                                                 sx_bulk_cntr_data_t           *counter_data_p);
 
+/**
+ *  This API reads the rate of a single counter from a bulk-counter-read buffer with rate computation enabled
+ *  (see sx_api_bulk_counter_buffer_attr_set).
+ *
+ *  rate_data_p returns the rate of each value of the counter, per second, as well as the hardware timestamps of the
+ *  current and previous reads used to compute it.
+ *
+ *  Supported devices: Spectrum, Spectrum2, Spectrum3, Spectrum4.
+ *
+ * @param[in] handle          - SX-API handle
+ * @param[in] key_p           - Counter key, as in sx_api_bulk_counter_transaction_get
+ * @param[in] buffer_p        - Valid buffer which was allocated by API sx_api_bulk_buffer_set()
+ * @param[out] rate_data_p    - Requested counter rate data
+ *
+ * @return SX_STATUS_SUCCESS             Operation completed successfully
+ * @return SX_STATUS_INVALID_HANDLE      NULL handle is received
+ * @return SX_STATUS_PARAM_NULL          Parameter is NULL
+ * @return SX_STATUS_PARAM_ERROR         Rate computation is not enabled on the buffer
+ * @return SX_STATUS_PARTIALLY_COMPLETE  Transaction is in progress
+ * @return SX_STATUS_ERROR               Operation failure
+ */
+sx_status_t sx_api_bulk_counter_transaction_rate_get(const sx_api_handle_t          handle,
+                                                     const sx_bulk_cntr_read_key_t *key_p,
+                                                     const sx_bulk_cntr_buffer_t   *buffer_p,
+                                                     sx_bulk_cntr_rate_data_t      *rate_data_p);
+
+/**
+ *  This API reads all the counters of a completed bulk-counter-read buffer in a single call.
+ *
+ *  The counters are copied to counter_data_list_p, and the key of each counter (in the format used by
+ *  sx_api_bulk_counter_transaction_get) is returned in the same index of key_list_p. Counters are returned in the
+ *  order of the buffer key:
+ *    For port counters: per logical port, per counter group; for per-priority/per-TC/per-priority-group groups,
+ *                       per priority/TC/priority group, in the order given in the key.
+ *    For flow counters: per counter ID, in ascending order.
+ *    For elephant detected flows: per logical port, per detected flow.
+ *    For stateful DB: per entry index.
+ *    For ACL rule counters: per ACL region ID, in the order given in the key (for an ACL/ACL group key, in the
+ *                           order of the regions of the ACL/group), and per rule offset, in ascending order. Rules
+ *                           without a counter are skipped.
+ *    For shared buffer counters (current/maximum usage and snapshot): per logical port, per ingress priority group
+ *                           and then per egress traffic class, in ascending order; followed by per ingress pool and
+ *                           then per egress pool, in ascending pool ID order; followed by the multicast counters, per
+ *                           switch priority in ascending order.
+ *    For flow estimator counters: per counter ID, in ascending order.
+ *  The order is fixed for a given buffer, so key_list_p may be NULL on subsequent reads of the same buffer.
+ *  Buffers of any other key type are not supported by this API and SX_STATUS_UNSUPPORTED is returned; their counters
+ *  are read with sx_api_bulk_counter_transaction_get.
+ *
+ *  If counter_data_list_p is NULL or *counter_cnt_p is 0, the number of counters in the buffer is returned in
+ *  *counter_cnt_p. If *counter_cnt_p is smaller than the number of counters in the buffer,
+ *  SX_STATUS_PARAM_EXCEEDS_RANGE is returned, the number of counters is returned in *counter_cnt_p and nothing is
+ *  copied to the lists.
+ *
+ *  Supported devices: Spectrum, Spectrum2, Spectrum3, Spectrum4.
+ *
+ * @param[in] handle                  - SX-API handle
+ * @param[in] buffer_p                - Valid buffer which was allocated by API sx_api_bulk_buffer_set()
+ * @param[out] key_list_p             - Key of each returned counter (may be NULL)
+ * @param[out] counter_data_list_p    - Counter data
+ * @param[in,out] counter_cnt_p       - [in] size of the lists/[out] number of counters in the buffer
+ *
+ * @return SX_STATUS_SUCCESS             Operation completed successfully
+ * @return SX_STATUS_INVALID_HANDLE      NULL handle is received
+ * @return SX_STATUS_PARAM_NULL          Parameter is NULL
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE Lists are too small, required size returned in *counter_cnt_p
+ * @return SX_STATUS_PARTIALLY_COMPLETE  Transaction is in progress
+ * @return SX_STATUS_UNSUPPORTED         Buffer key type is not supported
+ * @return SX_STATUS_ERROR               Operation failure
+ */
+sx_status_t sx_api_bulk_counter_transaction_all_get(const sx_api_handle_t        handle,
+                                                    const sx_bulk_cntr_buffer_t *buffer_p,
+                                                    sx_bulk_cntr_read_key_t     *key_list_p,
+                                                    sx_bulk_cntr_data_t         *counter_data_list_p,
+                                                    uint32_t                    *counter_cnt_p);
+
 /**
  * This API triggers the refresh of all accumulated (SX_FLOW_COUNTER_TYPE_ACCUMULATED) counters.
  *
@@ -216,4 +411,126 @@ sx_status_t sx_api_bulk_counter_refresh_set(const sx_api_handle_t
                                             const sx_access_cmd_t               cmd,
                                             const sx_bulk_cntr_refresh_attr_t * counter_refresh_attr_p);
 
+/**
+ * This API creates/destroys a periodic bulk-counter subscription.
+ *
+ * CREATE allocates a shared-memory ring of attr_p->slot_cnt buffers for the counters described by key_p (same key
+ * as in sx_api_bulk_counter_buffer_set) and starts reading them every attr_p->period_ms milliseconds with
+ * attr_p->cmd (READ/READ_CLEAR). Each completed read is published into the next slot of the ring together with its
+ * sequence number, the hardware timestamp of the read and its status, overwriting the oldest slot.
+ * No SX_BULK_READ_DONE event is sent for subscription reads. The subscription ID and the ring size are returned in
+ * subscription_p.
+ * DESTROY stops the subscription and frees the ring once all processes have unmapped it.
+ *
+ * Subscription reads use the bulk-counter transactions like any other read (see sx_api_bulk_counter_transaction_set)
+ * and are scheduled with the priority given in attr_p. If a read cannot be completed within the period, the next
+ * period is skipped and the skip is counted in the ring header.
+ *
+ * The following key types are supported: port counters, flow counters, ACL rule counters
+ * (SX_BULK_CNTR_KEY_TYPE_ACL_RULE_E), elephant detected flows, flow estimator counters, and shared buffer current and
+ * maximum usage. Shared buffer snapshot keys (SX_BULK_CNTR_SHARED_BUFFER_SNAPSHOT_E) are not supported, since each
+ * read requires a preceding sx_api_cos_sb_snapshot_action_set TAKE, and stateful DB keys
+ * (SX_BULK_CNTR_KEY_TYPE_STATEFUL_DB_E) are not supported, since a read may return only part of the partition and
+ * require READ_NEXT. For these key types SX_STATUS_PARAM_ERROR is returned.
+ *
+ * Supported devices: Spectrum, Spectrum2, Spectrum3, Spectrum4.
+ *
+ * @param[in] handle              - SX-API handle
+ * @param[in] cmd                 - CREATE/DESTROY
+ * @param[in] key_p               - Bulk-counter desired counters (ignored on DESTROY)
+ * @param[in] attr_p              - Subscription attributes: period, number of ring slots, read command, priority,
+ *                                  cookie (ignored on DESTROY)
+ * @param[in,out] subscription_p  - Subscription ID and ring size
+ *
+ * @return SX_STATUS_SUCCESS             Operation completed successfully
+ * @return SX_STATUS_INVALID_HANDLE      NULL handle is received
+ * @return SX_STATUS_PARAM_NULL          Parameter is NULL
+ * @return SX_STATUS_PARAM_ERROR         Parameter error or key type is not supported
+ * @return SX_STATUS_CMD_UNSUPPORTED     Invalid command
+ * @return SX_STATUS_NO_MEMORY           No free memory
+ * @return SX_STATUS_ENTRY_NOT_FOUND     Subscription is not found
+ * @return SX_STATUS_ERROR               Operation failed
+ */
+sx_status_t sx_api_bulk_counter_subscription_set(const sx_api_handle_t                   handle,
+                                                 const sx_access_cmd_t                   cmd,
+                                                 const sx_bulk_cntr_buffer_key_t        *key_p,
+                                                 const sx_bulk_cntr_subscription_attr_t *attr_p,
+                                                 sx_bulk_cntr_subscription_t            *subscription_p);
+
+/**
+ * This API maps/unmaps the shared-memory ring of a bulk-counter subscription into the calling process.
+ *
+ * CREATE maps the ring read-only and returns it in ring_pp. Any process may map the ring of any subscription.
+ * DESTROY unmaps the ring given in *ring_pp.
+ *
+ * The mapped ring is read with sx_api_bulk_counter_ring_latest_get and sx_api_bulk_counter_ring_counter_get, which
+ * do not communicate with the SDK and do not take locks.
+ *
+ * Supported devices: Spectrum, Spectrum2, Spectrum3, Spectrum4.
+ *
+ * @param[in] handle          - SX-API handle
+ * @param[in] cmd             - CREATE/DESTROY
+ * @param[in] subscription_p  - Subscription returned by sx_api_bulk_counter_subscription_set
+ * @param[in,out] ring_pp     - Mapped ring
+ *
+ * @return SX_STATUS_SUCCESS             Operation completed successfully
+ * @return SX_STATUS_INVALID_HANDLE      NULL handle is received
+ * @return SX_STATUS_PARAM_NULL          Parameter is NULL
+ * @return SX_STATUS_CMD_UNSUPPORTED     Invalid command
+ * @return SX_STATUS_ENTRY_NOT_FOUND     Subscription is not found
+ * @return SX_STATUS_ERROR               Operation failed
+ */
+sx_status_t sx_api_bulk_counter_ring_map_set(const sx_api_handle_t              handle,
+                                             const sx_access_cmd_t              cmd,
+                                             const sx_bulk_cntr_subscription_t *subscription_p,
+                                             sx_bulk_cntr_ring_t              **ring_pp);
+
+/**
+ * This API returns the sequence number and information (timestamp, read status, skipped periods) of the most recent
+ * snapshot published in a mapped bulk-counter ring.
+ *
+ * Readers can poll this API and process a snapshot when the sequence number changes. Snapshots older than the
+ * latest one remain available until overwritten, i.e. for the last slot_cnt sequence numbers.
+ *
+ * Supported devices: Spectrum, Spectrum2, Spectrum3, Spectrum4.
+ *
+ * @param[in] handle     - SX-API handle
+ * @param[in] ring_p     - Ring mapped by sx_api_bulk_counter_ring_map_set
+ * @param[out] seq_p     - Sequence number of the latest snapshot
+ * @param[out] info_p    - Snapshot information (may be NULL)
+ *
+ * @return SX_STATUS_SUCCESS             Operation completed successfully
+ * @return SX_STATUS_PARAM_NULL          Parameter is NULL
+ * @return SX_STATUS_ENTRY_NOT_FOUND     No snapshot was published yet
+ */
+sx_status_t sx_api_bulk_counter_ring_latest_get(const sx_api_handle_t          handle,
+                                                const sx_bulk_cntr_ring_t     *ring_p,
+                                                uint64_t                      *seq_p,
+                                                sx_bulk_cntr_ring_slot_info_t *info_p);
+
+/**
+ *  This API reads a single counter from a snapshot of a mapped bulk-counter ring.
+ *
+ *  The key has the same semantics as in sx_api_bulk_counter_transaction_get. The snapshot is validated after the
+ *  read, so a counter is never returned from a slot that is being overwritten.
+ *
+ *  Supported devices: Spectrum, Spectrum2, Spectrum3, Spectrum4.
+ *
+ * @param[in] handle          - SX-API handle
+ * @param[in] ring_p          - Ring mapped by sx_api_bulk_counter_ring_map_set
+ * @param[in] seq             - Sequence number of the snapshot
+ * @param[in] key_p           - Counter to read
+ * @param[out] counter_data_p - Requested counter data
+ *
+ * @return SX_STATUS_SUCCESS             Operation completed successfully
+ * @return SX_STATUS_PARAM_NULL          Parameter is NULL
+ * @return SX_STATUS_PARAM_ERROR         Key is not part of the subscription
+ * @return SX_STATUS_ENTRY_NOT_FOUND     Snapshot was overwritten or was not published yet
+ */
+sx_status_t sx_api_bulk_counter_ring_counter_get(const sx_api_handle_t          handle,
+                                                 const sx_bulk_cntr_ring_t     *ring_p,
+                                                 const uint64_t                 seq,
+                                                 const sx_bulk_cntr_read_key_t *key_p,
+                                                 sx_bulk_cntr_data_t           *counter_data_p);
+
 #endif /* ifndef __SX_API_BULK_COUNTER_H__ */
@@ -401,6 +401,58 @@ sx_status_t sx_api_fdb_uc_limit_fid_get(const sx_api_handle_t handle,
                                         const sx_fid_t        fid,
                                         uint32_t             *limit_p);
 
+/**
+ * This API retrieves the UC FDB occupancy of many ports and FIDs in a single call.
+ *
+ * For each port, port_occupancy_list_p returns:
+ *   - The logical port ID
+ *   - The number of MACs learned on the port (static and dynamic), as with sx_api_fdb_uc_port_count_get
+ *   - The number of dynamic MACs learned on the port
+ *   - The dynamic MAC limit (SX_FDB_MAX_ENTRIES if no limit is set)
+ *   - Whether the limit is exceeded, i.e., the number of dynamic MACs is greater than or equal to the limit
+ * For each FID, fid_occupancy_list_p returns the same information per FID.
+ *
+ * The objects to report are selected by filter_p:
+ *   - If filter_p is NULL, all ports and all FIDs with learned MACs or a configured limit are reported.
+ *   - If filter_p->log_port_cnt/filter_p->fid_cnt is non-zero, only the listed ports/FIDs are reported.
+ *   - If filter_p->limit_exceeded_only is TRUE, only objects whose dynamic MAC count reached their limit are reported.
+ *
+ * If port_occupancy_list_p is NULL or *port_cnt_p is 0, the number of ports matching the filter is returned in
+ * *port_cnt_p and no port entries are filled. FID entries follow the same rule with fid_occupancy_list_p/fid_cnt_p.
+ * If a list is non-empty but smaller than the number of matching entries, SX_STATUS_PARAM_EXCEEDS_RANGE is returned,
+ * the required number of entries of each list is returned in *port_cnt_p and *fid_cnt_p, and no entries are filled.
+ *
+ * Note: In 802.1D mode, instead of providing FIDs (filtering IDs), provide bridge_ids. Returned bridge_ids are stored
+ *       in fid_occupancy_list_p->fid.
+ * Note: On Spectrum4, per-FID occupancy is not supported (as with sx_api_fdb_uc_fid_count_get). fid_occupancy_list_p
+ *       must be NULL, filter_p->fid_cnt must be 0, and *fid_cnt_p is returned as 0.
+ *
+ * Supported devices: Spectrum, Spectrum2, Spectrum3, Spectrum4 (port occupancy only).
+ *
+ * @param[in] handle                   - SX-API handle
+ * @param[in] swid                     - Virtual switch partition ID
+ * @param[in] filter_p                 - Port/FID filter (may be NULL to report all objects)
+ * @param[out] port_occupancy_list_p   - Per-port learned and dynamic counts, limit and limit-exceeded flag
+ * @param[in,out] port_cnt_p           - [in] size of port_occupancy_list_p/[out] number of port entries returned
+ * @param[out] fid_occupancy_list_p    - Per-FID learned and dynamic counts, limit and limit-exceeded flag
+ * @param[in,out] fid_cnt_p            - [in] size of fid_occupancy_list_p/[out] number of FID entries returned
+ *
+ * @return SX_STATUS_SUCCESS              Operation completed successfully
+ * @return SX_STATUS_INVALID_HANDLE       Invalid handle
+ * @return SX_STATUS_PARAM_NULL           A parameter is NULL
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE  SWID/FID is out of range, or a list is smaller than required
+ * @return SX_STATUS_ENTRY_NOT_FOUND      A port/FID in the filter is not found in the database
+ * @return SX_STATUS_UNSUPPORTED          Per-FID occupancy is requested on Spectrum4
+ * @return SX_STATUS_ERROR                General error
+ */
+sx_status_t sx_api_fdb_uc_occupancy_bulk_get(const sx_api_handle_t               handle,
+                                             const sx_swid_t                     swid,
+                                             const sx_fdb_uc_occupancy_filter_t *filter_p,
+                                             sx_fdb_uc_port_occupancy_t         *port_occupancy_list_p,
+                                             uint32_t                           *port_cnt_p,
+                                             sx_fdb_uc_fid_occupancy_t          *fid_occupancy_list_p,
+                                             uint32_t                           *fid_cnt_p);
+
 /**
  * This API adds/deletes MC MAC entries from the FDB.
  *
@@ -541,6 +593,44 @@ sx_status_t sx_api_fdb_mc_mac_addr_iter_get(const sx_api_handle_t         handle
                                             sx_fdb_mc_mac_key_t          *key_list_p,
                                             uint32_t                     *key_cnt_p);
 
+/**
+ * This API is a bulk, multi-group form of sx_api_fdb_mc_mac_addr_set with SX_ACCESS_CMD_DELETE_PORTS and
+ * SX_ACCESS_CMD_ADD_PORTS. It applies port membership changes to many existing MC MAC entries in a single call.
+ *
+ * Each element of delta_list_p holds an MC MAC key (VLAN ID + MC MAC address), a list of logical ports to add and a
+ * list of logical ports to remove. For each element, the removed ports are handled as with DELETE_PORTS and then the
+ * added ports are handled as with ADD_PORTS, including the handling of LAG ports and their members.
+ * Adding a port that is already a member, or removing a port that is not a member, is not an error.
+ *
+ * Elements are processed independently. In case the operation fails on one or more elements, an error is returned
+ * and delta_list_p stores those elements and their quantity is stored in delta_cnt_p, as with
+ * sx_api_fdb_uc_mac_addr_set. The error returned is the one of the first failed element.
+ * Upon successful completion, SUCCESS is returned and delta_cnt_p and delta_list_p are unchanged.
+ *
+ * Note: MC MAC entries must already exist (created with sx_api_fdb_mc_mac_addr_set and SX_ACCESS_CMD_ADD).
+ * Note: In 802.1D mode, instead of providing a VID (VLAN ID) in the key, provide a bridge_id.
+ *
+ * Supported devices: Spectrum, Spectrum2, Spectrum3, Spectrum4.
+ *
+ * @param[in] handle            - SX-API handle
+ * @param[in] swid              - Virtual switch partition ID
+ * @param[in,out] delta_list_p  - [in] list of MC MAC port deltas/[out] failed deltas
+ * @param[in,out] delta_cnt_p   - [in] number of deltas/[out] number of failed deltas
+ *
+ * @return SX_STATUS_SUCCESS              Operation completed successfully
+ * @return SX_STATUS_INVALID_HANDLE       NULL handle received
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE  Parameter exceeds the range
+ * @return SX_STATUS_PARAM_NULL           A parameter is NULL
+ * @return SX_STATUS_NO_MEMORY            Memory allocation failure
+ * @return SX_STATUS_PARAM_ERROR          Input parameter is invalid
+ * @return SX_STATUS_ENTRY_NOT_FOUND      Requested MC MAC entry is not found in the database
+ * @return SX_STATUS_ERROR                General error
+ */
+sx_status_t sx_api_fdb_mc_mac_addr_ports_bulk_set(const sx_api_handle_t       handle,
+                                                  const sx_swid_t             swid,
+                                                  sx_fdb_mc_mac_port_delta_t *delta_list_p,
+                                                  uint32_t                   *delta_cnt_p);
+
 
 /**
  * This API adds/deletes FDB MC MAC entries from/to a multicast container (the MC container should have already been created).
@@ -795,6 +885,58 @@ sx_status_t sx_api_fdb_mc_flush_fid_set(const sx_api_handle_t handle,
 sx_status_t sx_api_fdb_flush_by_type_set(const sx_api_handle_t  handle,
                                          const sx_flush_data_t *flush_data_p);
 
+/**
+ * This API deletes all UC FDB table entries that match the provided flush filter.
+ *
+ * The filter is a conjunction of the following criteria. A criterion with an empty list (count 0) is not applied:
+ *   - log_port_list_p/log_port_cnt       - Entries learned on one of the listed logical ports (LAG ports included).
+ *                                          A tunnel port in the list has the semantics of SX_FDB_NOTIFY_TYPE_FLUSH_PORT:
+ *                                          entries that point only to the tunnel of this port, directly or through an
+ *                                          ECMP container
+ *   - fid_list_p/fid_cnt                 - Entries learned on one of the listed FIDs
+ *   - tunnel_port_list_p/tunnel_port_cnt - Entries that point to an ECMP container whose set of tunnels is exactly the
+ *                                          set of the listed tunnel ports, as with SX_FDB_NOTIFY_TYPE_FLUSH_TUNNEL_PORT
+ *   - entry_type_mask                    - Entries whose type is selected in the mask, where bit (1 << type) selects
+ *                                          the sx_fdb_uc_mac_entry_type_t value type (SX_FDB_UC_STATIC,
+ *                                          SX_FDB_UC_AGEABLE, SX_FDB_UC_NONAGEABLE, ...). A mask of 0 is not applied
+ *                                          (entries of all types match), same as an empty list
+ *   - age_threshold                      - Entries whose activity age is greater than or equal to age_threshold seconds,
+ *                                          0 for no age criterion. The activity age of an entry is the time since the
+ *                                          SDK last saw the entry active in the hardware, and is updated every FDB
+ *                                          polling interval (see sx_api_fdb_polling_interval_set), so it has the
+ *                                          polling interval granularity. Only SX_FDB_UC_AGEABLE entries have an
+ *                                          activity age; static and non-ageable entries never match a non-zero
+ *                                          age_threshold
+ *
+ * All matching entries are removed in a single pass over the FDB, instead of one flush operation per port/FID.
+ * A filter with no criteria at all is rejected; use sx_api_fdb_uc_flush_all_set to flush the whole table.
+ *
+ * Note: Since both criteria would have to match, tunnel ports in log_port_list_p cannot be combined with a non-empty
+ *       tunnel_port_list_p; such a filter is rejected with SX_STATUS_PARAM_ERROR. To flush by several tunnel ports
+ *       with FLUSH_PORT semantics, list them in log_port_list_p only.
+ * Note: In 802.1D mode, instead of providing FIDs (filtering IDs) in fid_list_p, provide bridge_ids.
+ * Note: A flush notification is sent per flushed FDB entry type, same as with the other flush APIs.
+ *
+ * Supported devices: Spectrum, Spectrum2, Spectrum3, Spectrum4.
+ *
+ * @param[in] handle          - SX-API handle
+ * @param[in] swid            - Virtual switch partition ID
+ * @param[in] filter_p        - Flush filter (sets of ports/FIDs/tunnel ports, entry type mask, age threshold)
+ * @param[out] flushed_cnt_p  - Number of flushed entries (may be NULL if not required)
+ *
+ * @return SX_STATUS_SUCCESS              if operation completes successfully
+ * @return SX_STATUS_INVALID_HANDLE       if NULL handle is received
+ * @return SX_STATUS_PARAM_NULL           if filter_p is NULL
+ * @return SX_STATUS_PARAM_ERROR          if filter is empty or any filter parameter is invalid
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE  if a list count exceeds the range
+ * @return SX_STATUS_ENTRY_NOT_FOUND      if a port/FID in the filter is not found in the database
+ * @return SX_STATUS_ERROR                for a general error
+ */
+sx_status_t sx_api_fdb_flush_by_filter_set(const sx_api_handle_t        handle,
+                                           const sx_swid_t              swid,
+                                           const sx_fdb_flush_filter_t *filter_p,
+                                           uint32_t                    *flushed_cnt_p);
+
 
 /**
  * \deprecated This API is deprecated and will be removed in the future.
@@ -1271,6 +1413,56 @@ sx_status_t sx_api_fdb_igmpv3_state_get(const sx_api_handle_t  handle,
                                         const sx_fid_t         fid,
                                         sx_fdb_igmpv3_state_t* fdb_igmpv3_snooping_state);
 
+/**
+ * This API sets the IGMPv3 source-filter state of many MC groups in a single call.
+ *
+ * Each element of entry_list_p holds the router state of one group: FID, group address, filter mode (INCLUDE/EXCLUDE),
+ * a list of source addresses and the MC IP action (action/container ID/trap) to use for forwarded traffic.
+ * The state is the aggregated state of the group after merging the group records of all receivers, as kept by an
+ * IGMPv3 router (RFC 3376, section 6.2.1), and not a single group record of a report: for example, the group is in
+ * EXCLUDE mode if any receiver is in EXCLUDE mode, and its source list is then the list of sources excluded by all
+ * receivers. Merging the records of the receivers is the responsibility of the user.
+ * The SDK translates each element into the MC IP entries of sx_api_fdb_mc_ip_addr_group_set:
+ *   - INCLUDE: an (S,G) entry with the given action for each listed source, and no (*,G) entry.
+ *   - EXCLUDE: a (*,G) entry with the given action, and a DISCARD (S,G) entry for each listed source.
+ *
+ * SET replaces the state of each listed group: entries created by this API for the previous state of the group and not
+ * part of the new state are removed. DELETE removes all the entries created by this API for each listed group (filter
+ * mode and source list are ignored). Hardware updates of all elements are aggregated and committed together.
+ *
+ * This API manages only the MC IP entries it created. Entries created directly with sx_api_fdb_mc_ip_addr_group_set are
+ * never modified or removed by this API. If an element requires an (S,G) or (*,G) entry that was created directly with
+ * sx_api_fdb_mc_ip_addr_group_set, the element fails with SX_STATUS_ENTRY_ALREADY_EXISTS and the state of its group is
+ * not changed.
+ *
+ * Elements are processed independently. In case the operation fails on one or more elements, an error is returned and
+ * entry_list_p stores those elements and their quantity is stored in entry_cnt_p, as with sx_api_fdb_uc_mac_addr_set.
+ * The error returned is the one of the first failed element.
+ * Upon successful completion, SUCCESS is returned and entry_cnt_p and entry_list_p are unchanged.
+ *
+ * Note: IGMPv3 snooping must be enabled on the FID of each element (see sx_api_fdb_igmpv3_state_set).
+ *
+ * Supported devices: Spectrum, Spectrum2, Spectrum3, Spectrum4.
+ *
+ * @param[in] handle            - SX-API handle
+ * @param[in] cmd               - SET/DELETE
+ * @param[in,out] entry_list_p  - [in] list of group states/[out] failed group states
+ * @param[in,out] entry_cnt_p   - [in] number of group states/[out] number of failed group states
+ *
+ * @return SX_STATUS_SUCCESS              Operation completed successfully
+ * @return SX_STATUS_INVALID_HANDLE       NULL handle received
+ * @return SX_STATUS_CMD_UNSUPPORTED      Unsupported command
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE  Parameter exceeds the range
+ * @return SX_STATUS_PARAM_NULL           A parameter is NULL
+ * @return SX_STATUS_NO_MEMORY            Memory allocation failure
+ * @return SX_STATUS_ENTRY_ALREADY_EXISTS An entry required by a group was created with sx_api_fdb_mc_ip_addr_group_set
+ * @return SX_STATUS_ERROR                General error
+ */
+sx_status_t sx_api_fdb_igmpv3_group_state_bulk_set(const sx_api_handle_t        handle,
+                                                   const sx_access_cmd_t        cmd,
+                                                   sx_fdb_igmpv3_group_state_t *entry_list_p,
+                                                   uint32_t                    *entry_cnt_p);
+
 /**
  * This API sets MC IP entries using a multicast container as the destination.
  *
@@ -1623,4 +1815,138 @@ sx_status_t sx_api_fdb_uc_local_protect_set(const sx_api_handle_t
                                             const sx_api_fdb_uc_protection_key_t  *protection_key_p,
                                             const sx_api_fdb_uc_protection_data_t *protection_data_p);
 
+/**
+ * This API creates/destroys a client-side mirror of the UC FDB table of a switch partition.
+ *
+ * The mirror is a hash-indexed copy of the UC FDB kept in the address space of the calling process and bound to the
+ * handle. Once created, lookups with sx_api_fdb_uc_mirror_get are served locally, without any IPC to the SDK.
+ *
+ * The mirror is kept up to date from two sources:
+ *   - FDB notifications (learned/aged/flushed entries) received by the user on SX_TRAP_ID_FDB_EVENT and passed to
+ *     sx_api_fdb_uc_mirror_notify_set.
+ *   - Periodic reconciliation against the software FDB table, every attr_p->reconcile_interval seconds (0 to disable).
+ *     Reconciliation runs in a thread of the API library and reads the table in chunks, so it does not block lookups.
+ *     Entries that changed without a notification (e.g. entries set by another process) are fixed and counted.
+ *
+ * CREATE populates the mirror with the current content of the software FDB table before returning.
+ * DESTROY frees all memory of the mirror. Closing the handle destroys the mirror as well.
+ *
+ * Only one mirror per swid can be created on a handle.
+ *
+ * Supported devices: Spectrum, Spectrum2, Spectrum3, Spectrum4.
+ *
+ * @param[in] handle   - SX-API handle
+ * @param[in] cmd      - CREATE/DESTROY
+ * @param[in] swid     - Virtual switch partition ID
+ * @param[in] attr_p   - Mirror attributes (reconcile interval, initial hash size). Ignored on DESTROY.
+ *
+ * @return SX_STATUS_SUCCESS              Operation completed successfully
+ * @return SX_STATUS_INVALID_HANDLE       NULL handle received
+ * @return SX_STATUS_CMD_UNSUPPORTED      Unsupported command
+ * @return SX_STATUS_PARAM_NULL           A parameter is NULL
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE  Parameter exceeds the range
+ * @return SX_STATUS_NO_MEMORY            Memory allocation failure
+ * @return SX_STATUS_ENTRY_ALREADY_EXISTS A mirror already exists for this swid
+ * @return SX_STATUS_ENTRY_NOT_FOUND      No mirror exists for this swid (DESTROY)
+ * @return SX_STATUS_ERROR                General error
+ */
+sx_status_t sx_api_fdb_uc_mirror_set(const sx_api_handle_t          handle,
+                                     const sx_access_cmd_t          cmd,
+                                     const sx_swid_t                swid,
+                                     const sx_fdb_uc_mirror_attr_t *attr_p);
+
+/**
+ * This API applies FDB notification records to the client-side UC FDB mirror.
+ *
+ * The notification data is the one received on SX_TRAP_ID_FDB_EVENT (receive_info.event_info.fdb_event).
+ * Learned records add entries, aged/flushed records remove entries, and flush records by port/FID/type remove all
+ * matching entries of the mirror. The API does not access the SDK.
+ *
+ * Note: FDB notification records carry no sequence numbers, so this API cannot detect notifications that were lost
+ *       (e.g., dropped from the trap queue or not passed to the API). Entries missed this way are fixed by the next
+ *       periodic reconciliation. If reconciliation is disabled, the user should destroy and re-create the mirror
+ *       after a known loss of notifications (e.g., trap group drop counters increase).
+ *
+ * Supported devices: Spectrum, Spectrum2, Spectrum3, Spectrum4.
+ *
+ * @param[in] handle          - SX-API handle
+ * @param[in] swid            - Virtual switch partition ID
+ * @param[in] notify_data_p   - FDB notification data
+ *
+ * @return SX_STATUS_SUCCESS              Operation completed successfully
+ * @return SX_STATUS_INVALID_HANDLE       NULL handle received
+ * @return SX_STATUS_PARAM_NULL           A parameter is NULL
+ * @return SX_STATUS_ENTRY_NOT_FOUND      No mirror exists for this swid
+ * @return SX_STATUS_NO_MEMORY            Memory allocation failure
+ * @return SX_STATUS_ERROR                General error
+ */
+sx_status_t sx_api_fdb_uc_mirror_notify_set(const sx_api_handle_t       handle,
+                                            const sx_swid_t             swid,
+                                            const sx_fdb_notify_data_t *notify_data_p);
+
+/**
+ * This API reads MAC entries from the client-side UC FDB mirror, without IPC to the SDK.
+ *
+ * The input parameters have the same semantics as in sx_api_fdb_uc_mac_addr_get:
+ *   1) GET with a MAC+FID key and data_cnt_p equal to 1 performs a hash lookup of a single entry.
+ *   2) GET_FIRST/GETNEXT with key_filter_p return the entries of a FID and/or a logical port, using the per-FID and
+ *      per-port indexes of the mirror.
+ * There is no SX_FDB_MAX_GET_ENTRIES limit; up to *data_cnt_p entries are returned.
+ *
+ * Note: The mirror may lag behind the hardware by the notification and reconciliation delay. Use
+ *       sx_api_fdb_uc_mirror_stats_get to check the time since the last processed notification and reconciliation.
+ *
+ * Supported devices: Spectrum, Spectrum2, Spectrum3, Spectrum4.
+ *
+ * @param[in] handle         - SX-API handle
+ * @param[in] swid           - Virtual switch partition ID
+ * @param[in] cmd            - GET/GETNEXT/GET_FIRST
+ * @param[in] mac_type       - static/dynamic/all
+ * @param[in] key_p          - MAC entry with information for search (MAC+FID)
+ * @param[in] key_filter_p   - Filter types used on the mac_list_p (FID/MAC/logical port)
+ * @param[out] mac_list_p    - Pointer to list
+ * @param[in,out] data_cnt_p - [in] Number of entries to retrieve/[out] retrieved number of entries
+ *
+ * @return SX_STATUS_SUCCESS              Operation completed successfully
+ * @return SX_STATUS_INVALID_HANDLE       NULL handle received
+ * @return SX_STATUS_CMD_UNSUPPORTED      Unsupported command
+ * @return SX_STATUS_PARAM_NULL           A parameter is NULL
+ * @return SX_STATUS_ENTRY_NOT_FOUND      Requested element is not found in the mirror, or no mirror exists for this swid
+ * @return SX_STATUS_ERROR                General error
+ */
+sx_status_t sx_api_fdb_uc_mirror_get(const sx_api_handle_t              handle,
+                                     const sx_swid_t                    swid,
+                                     const sx_access_cmd_t              cmd,
+                                     const sx_fdb_uc_mac_entry_type_t   mac_type,
+                                     const sx_fdb_uc_mac_addr_params_t *key_p,
+                                     const sx_fdb_uc_key_filter_t      *key_filter_p,
+                                     sx_fdb_uc_mac_addr_params_t       *mac_list_p,
+                                     uint32_t                          *data_cnt_p);
+
+/**
+ * This API retrieves the statistics of the client-side UC FDB mirror.
+ *
+ * The statistics include the number of mirrored entries, the number of processed notification records, the time since
+ * the last processed notification and since the last completed reconciliation, the number of entries fixed by the last
+ * reconciliation, and whether a reconciliation is currently in progress.
+ *
+ * Supported devices: Spectrum, Spectrum2, Spectrum3, Spectrum4.
+ *
+ * @param[in] handle      - SX-API handle
+ * @param[in] cmd         - READ/READ_CLEAR (clears the accumulated counters)
+ * @param[in] swid        - Virtual switch partition ID
+ * @param[out] stats_p    - Mirror statistics
+ *
+ * @return SX_STATUS_SUCCESS              Operation completed successfully
+ * @return SX_STATUS_INVALID_HANDLE       NULL handle received
+ * @return SX_STATUS_CMD_UNSUPPORTED      Unsupported command
+ * @return SX_STATUS_PARAM_NULL           A parameter is NULL
+ * @return SX_STATUS_ENTRY_NOT_FOUND      No mirror exists for this swid
+ * @return SX_STATUS_ERROR                General error
+ */
+sx_status_t sx_api_fdb_uc_mirror_stats_get(const sx_api_handle_t     handle,
+                                           const sx_access_cmd_t     cmd,
+                                           const sx_swid_t           swid,
+                                           sx_fdb_uc_mirror_stats_t *stats_p);
+
 #endif /* __SX_API_FDB_H__ */
@@ -175,6 +175,62 @@ sx_status_t sx_api_port_mapping_get(const sx_api_handle_t   handle,
                                     sx_port_mapping_t      *port_mapping_list_p,
                                     const uint32_t          port_cnt);
 
+/**
+ * This API changes the mapping (breakout) of a set of ports as a single transaction.
+ * It replaces the sequence of sx_api_port_state_set DOWN, sx_api_port_deinit_set, sx_api_port_swid_bind_set,
+ * sx_api_port_mapping_set, sx_api_port_init_set and sx_api_port_state_set UP done by the user per port.
+ *
+ * old_mapping_list_p holds the mapping the user expects each port to have and is compared to the current mapping
+ * kept in the SDK database before anything is changed. If any port does not match, the API fails with
+ * SX_STATUS_PARAM_ERROR and no port is changed.
+ * A port whose new mapping equals its old mapping is not touched, and neither is any port not in log_port_list_p,
+ * including other ports on the same module. A port with width 0 in new_mapping_list_p is unmapped.
+ * The lanes of each new mapping are checked against the mappings that remain after the transaction. If a new mapping
+ * uses a lane of a port that is not in log_port_list_p, or a lane used by another new mapping, the API fails with
+ * SX_STATUS_RESOURCE_IN_USE before anything is changed, and the conflicting port is returned in report_list_p of the
+ * port with the new mapping.
+ * All remapped ports are torn down first, then all new mappings are applied, and then the new ports are initialized.
+ * New ports are bound to tx_attr_p->swid and are set to the admin state given in tx_attr_p->admin_state.
+ * The PHY bring-up of new ports set to UP follows the port bring-up mode set by sx_api_port_bringup_attr_set, as
+ * with sx_api_port_state_set; in parallel mode, up to the configured maximum number of ports are brought up
+ * concurrently. The API returns once all new ports are initialized and their admin state is set, without waiting for
+ * the ports to become operationally UP.
+ *
+ * If a step fails, the ports already changed are restored to their old mapping, SWID binding and admin state, and
+ * the status of the failing step is returned.
+ *
+ * The per-port action taken (unchanged, unmapped, remapped or mapped) and the time spent in the teardown, mapping and
+ * initialization stages of the port are returned in report_list_p, in the order of log_port_list_p. The timing of the
+ * PHY bring-up of the new ports is read with sx_api_port_bringup_timing_get.
+ *
+ * Supported devices: Spectrum, Spectrum2, Spectrum3, Spectrum4.
+ *
+ * @param[in] handle              - SX-API handle
+ * @param[in] log_port_list_p     - List of logical ports
+ * @param[in] old_mapping_list_p  - Expected current mapping of each port
+ * @param[in] new_mapping_list_p  - New mapping of each port
+ * @param[in] port_cnt            - Number of ports
+ * @param[in] tx_attr_p           - Transaction attributes (SWID, admin state)
+ * @param[out] report_list_p      - Per-port action and stage timing (may be NULL)
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully
+ * @return SX_STATUS_COMM_ERROR if client communication fails
+ * @return SX_STATUS_INVALID_HANDLE if a NULL handle is received
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL
+ * @return SX_STATUS_PARAM_ERROR if an input parameter is invalid or the current mapping does not match old_mapping_list_p
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if a parameter exceed its range
+ * @return SX_STATUS_RESOURCE_IN_USE if a port to be unmapped is still in use (e.g., LAG member) or a new mapping
+ *         uses a lane of a port that is not remapped
+ * @return SX_STATUS_ERROR general error
+ */
+sx_status_t sx_api_port_mapping_transaction_set(const sx_api_handle_t            handle,
+                                                const sx_port_log_id_t          *log_port_list_p,
+                                                const sx_port_mapping_t         *old_mapping_list_p,
+                                                const sx_port_mapping_t         *new_mapping_list_p,
+                                                const uint32_t                   port_cnt,
+                                                const sx_port_mapping_tx_attr_t *tx_attr_p,
+                                                sx_port_mapping_tx_report_t     *report_list_p);
+
 
 /**
  * This API retrieves the devices info list from the SDK.
@@ -641,6 +697,10 @@ sx_status_t sx_api_port_phys_loopback_get(const sx_api_handle_t    handle,
  * This API sets the port administrative state in the SDK.
  *
  * Note: This API supports port profile.
+ * Note: When the port bring-up mode is SX_PORT_BRINGUP_MODE_PARALLEL_E (see sx_api_port_bringup_attr_set), setting
+ *       the state to UP returns once the PHY bring-up request is queued, and SX_STATUS_SUCCESS does not mean that the
+ *       PHY bring-up succeeded. A bring-up failure after queuing is not returned by this API: the port stays
+ *       operationally DOWN, and the failing stage and its status are reported by sx_api_port_bringup_timing_get.
  *
  * Supported devices: Spectrum, Spectrum2, Spectrum3, Spectrum4.
  *
@@ -685,6 +745,96 @@ sx_status_t sx_api_port_state_get(const sx_api_handle_t   handle,
                                   sx_port_admin_state_t  *admin_state_p,
                                   sx_port_module_state_t *module_state_p);
 
+/**
+ * This API sets the port bring-up mode.
+ * In SX_PORT_BRINGUP_MODE_SERIAL_E (default), the PHY of each port set to UP by sx_api_port_state_set is brought up
+ * before the next one is handled.
+ * In SX_PORT_BRINGUP_MODE_PARALLEL_E, sx_api_port_state_set UP returns once the request is queued, and the PHY
+ * bring-up (module detection, module info read, auto-negotiation and link training) of up to
+ * bringup_attr_p->max_parallel ports is done concurrently. The port operational state is reported as usual by the
+ * port state change event. A bring-up failure after the request is queued is not returned by
+ * sx_api_port_state_set; the port stays operationally DOWN, and the failing stage and its status are reported by
+ * sx_api_port_bringup_timing_get.
+ * UNSET sets the bring-up mode back to the default.
+ *
+ * Note: Changing the mode does not affect ports already in bring-up.
+ *
+ * Supported devices: Spectrum, Spectrum2, Spectrum3, Spectrum4.
+ *
+ * @param[in] handle          - SX-API handle
+ * @param[in] cmd             - SET/UNSET
+ * @param[in] bringup_attr_p  - Bring-up attributes (mode, maximum number of ports brought up in parallel)
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully
+ * @return SX_STATUS_COMM_ERROR if client communication fails
+ * @return SX_STATUS_INVALID_HANDLE if a NULL handle is received
+ * @return SX_STATUS_PARAM_ERROR if an input parameter is invalid
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if max_parallel is out of range
+ * @return SX_STATUS_CMD_UNSUPPORTED if command is not supported
+ * @return SX_STATUS_ERROR general error
+ */
+sx_status_t sx_api_port_bringup_attr_set(const sx_api_handle_t         handle,
+                                         const sx_access_cmd_t         cmd,
+                                         const sx_port_bringup_attr_t *bringup_attr_p);
+
+/**
+ * This API retrieves the port bring-up mode.
+ *
+ * Supported devices: Spectrum, Spectrum2, Spectrum3, Spectrum4.
+ *
+ * @param[in] handle          - SX-API handle
+ * @param[out] bringup_attr_p - Bring-up attributes
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully
+ * @return SX_STATUS_COMM_ERROR if client communication fails
+ * @return SX_STATUS_INVALID_HANDLE if a NULL handle is received
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL
+ * @return SX_STATUS_ERROR general error
+ */
+sx_status_t sx_api_port_bringup_attr_get(const sx_api_handle_t   handle,
+                                         sx_port_bringup_attr_t *bringup_attr_p);
+
+/**
+ * This API retrieves the timing of the last bring-up of a list of ports.
+ * For each port, the time in milliseconds from the admin UP request to the end of each bring-up stage is returned:
+ *   - Bring-up start (the port was dequeued and its bring-up started). In SX_PORT_BRINGUP_MODE_PARALLEL_E, this is
+ *     the time the port waited for one of the max_parallel bring-up slots; in serial mode, the time it waited for
+ *     the bring-up of the previous ports.
+ *   - Module detected (module present and powered up)
+ *   - Module info read (the data returned by sx_mgmt_phy_module_info_get is available)
+ *   - Auto-negotiation and link training done
+ *   - Operational state UP
+ * The duration of a stage is the difference from the end of the previous stage, so the queue wait is not included in
+ * the module detection time.
+ * A stage that was not reached is reported as 0 and the last stage reached is indicated in the entry. If the
+ * bring-up failed, the entry also holds the stage that failed and the failure status.
+ * The following options are available:
+ * 1. Read the timing (using SX_ACCESS_CMD_READ).
+ * 2. Read and clear the timing (using SX_ACCESS_CMD_READ_CLEAR).
+ *
+ * Supported devices: Spectrum, Spectrum2, Spectrum3, Spectrum4.
+ *
+ * @param[in] handle            - SX-API handle
+ * @param[in] cmd               - READ/READ_CLEAR
+ * @param[in] log_port_list_p   - List of logical ports
+ * @param[out] timing_list_p    - Bring-up timing of each port
+ * @param[in] port_cnt          - Number of logical ports
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully
+ * @return SX_STATUS_COMM_ERROR if client communication fails
+ * @return SX_STATUS_INVALID_HANDLE if a NULL handle is received
+ * @return SX_STATUS_PARAM_ERROR if an input parameter is invalid
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL
+ * @return SX_STATUS_CMD_UNSUPPORTED if command is not supported
+ * @return SX_STATUS_ERROR general error
+ */
+sx_status_t sx_api_port_bringup_timing_get(const sx_api_handle_t     handle,
+                                           const sx_access_cmd_t     cmd,
+                                           const sx_port_log_id_t   *log_port_list_p,
+                                           sx_port_bringup_timing_t *timing_list_p,
+                                           const uint32_t            port_cnt);
+
 /**
  *
  * This API sets the port flow control pause configuration.
@@ -1130,6 +1280,64 @@ sx_status_t sx_api_port_counter_phy_layer_internal_link_get(const sx_api_handle_
                                                             const sx_port_phys_link_side_t          link_side,
                                                             sx_port_cntr_phy_layer_internal_link_t *cntr_p);
 
+/**
+ * This API retrieves several port counter groups for a list of ports in a single synchronous call.
+ *
+ * cntr_grp_mask is a bitmask of counter groups (1 << SX_PORT_CNTR_GRP_*). For each selected group, cntr_bulk_p holds
+ * a caller-allocated array, and the counters are returned as a structure of arrays indexed by the position of the port
+ * in log_port_list_p:
+ *   - IEEE_802_3, RFC_2863, RFC_2819, RFC_3635, DISCARD - one entry per port: array[port_idx].
+ *   - PHY_LAYER    - one entry per port: array[port_idx], as returned by sx_api_port_counter_phy_layer_get.
+ *                    PHY layer statistics (sx_api_port_counter_phy_layer_statistics_get) are not included.
+ *   - PRIO         - one entry per port and IEEE priority: array[port_idx * prio_cnt + prio_idx].
+ *   - PERF         - one entry per port and performance counter priority:
+ *                    array[port_idx * perf_prio_cnt + perf_prio_idx].
+ *   - TC           - one entry per port and TC: array[port_idx * tc_cnt + tc_idx].
+ *   - BUFF         - one entry per port and buffer: array[port_idx * buff_cnt + buff_idx].
+ * The IDs to read are given by the ID lists (and counts) in cntr_bulk_p, and each index is the position of the ID in
+ * its list:
+ *   - prio_id_list_p/prio_cnt           - sx_cos_ieee_prio_t values, as in sx_api_port_counter_prio_get
+ *   - perf_prio_id_list_p/perf_prio_cnt - sx_port_prio_id_t values, as in sx_api_port_counter_perf_get
+ *                                         (on Spectrum, only prio_id=0 is supported)
+ *   - tc_id_list_p/tc_cnt               - TC IDs, as in sx_api_port_counter_tc_get
+ *   - buff_id_list_p/buff_cnt           - priority group IDs, as in sx_api_port_counter_buff_get
+ * IDs are validated for the device before anything is read. If an ID is not supported, SX_STATUS_PARAM_EXCEEDS_RANGE
+ * is returned and no counter is read or cleared.
+ * Arrays of groups not selected in cntr_grp_mask are ignored and may be NULL.
+ *
+ * The per-group semantics (LAG support, per-device notes) are the same as in the per-port APIs
+ * (sx_api_port_counter_rfc_2863_get, sx_api_port_counter_prio_get, etc.). If a group is not supported for a port
+ * (e.g. PERF for a LAG), the counters of that group are returned as zero for the port, and the group bit is cleared in
+ * cntr_bulk_p->valid_grp_mask_list_p[port_idx]. A group bit is never cleared because of an ID, so all the
+ * counters of a group whose bit is set are valid.
+ *
+ * READ_CLEAR clears all the selected counter groups of all the listed ports after reading them.
+ *
+ * Supported devices: Spectrum, Spectrum2, Spectrum3, Spectrum4.
+ *
+ * @param[in] handle          - SX-API handle
+ * @param[in] cmd             - READ/READ_CLEAR
+ * @param[in] log_port_list_p - List of logical port IDs
+ * @param[in] port_cnt        - Number of logical ports
+ * @param[in] cntr_grp_mask   - Bitmask of counter groups to read
+ * @param[in,out] cntr_bulk_p - Caller-allocated per-group counter arrays, filled as described above
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully
+ * @return SX_STATUS_COMM_ERROR if client communication fails
+ * @return SX_STATUS_INVALID_HANDLE if a NULL handle is received
+ * @return SX_STATUS_PARAM_NULL if a parameter or an array of a selected group is NULL
+ * @return SX_STATUS_PARAM_ERROR if an input parameter is invalid
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if a priority/TC/buffer ID is not supported
+ * @return SX_STATUS_CMD_UNSUPPORTED if command is not supported
+ * @return SX_STATUS_ENTRY_NOT_FOUND if a port is not found in the DB
+ */
+sx_status_t sx_api_port_counter_bulk_get(const sx_api_handle_t   handle,
+                                         const sx_access_cmd_t   cmd,
+                                         const sx_port_log_id_t *log_port_list_p,
+                                         const uint32_t          port_cnt,
+                                         const uint32_t          cntr_grp_mask,
+                                         sx_port_cntr_bulk_t    *cntr_bulk_p);
+
 /**
  * This API initializes the port in the SDK.
  *
@@ -1972,6 +2180,80 @@ sx_status_t sx_api_port_ber_monitor_operational_get(const sx_api_handle_t
                                                     const sx_port_log_id_t           log_port,
                                                     sx_port_ber_monitor_oper_data_t *monitor_oper_data_p);
 
+/**
+ * This API configures the PHY statistics monitor, which periodically samples the PHY layer statistics of a list of
+ * ports and delivers the samples through the event channel, so the user does not need to poll each port.
+ *
+ * Every monitor_attr_p->sample_period_ms, the SDK reads, for each monitored port, the counters selected in
+ * monitor_attr_p->stats_mask: FEC corrected and uncorrected counts, raw and effective BER, and the PHY layer
+ * statistics returned by sx_api_port_counter_phy_layer_statistics_get (external link side).
+ * The samples are sent as compact records (counter deltas since the previous sample and BER values) in
+ * SX_TRAP_ID_PORT_PHY_STATS_RECORDS events, with up to monitor_attr_p->records_per_event records per event.
+ * When the BER or the uncorrected count per sample of a port crosses the matching threshold in monitor_attr_p, an
+ * SX_TRAP_ID_PORT_PHY_STATS_THRESHOLD event is sent with the port, the crossed threshold and its direction.
+ * A crossing in the same direction is not reported again until the value crosses back.
+ *
+ * CREATE starts the monitor on the given ports (port_cnt 0 monitors all network ports).
+ * EDIT replaces the monitor attributes and port list.
+ * DESTROY stops the monitor (log_port_list_p and monitor_attr_p are ignored).
+ *
+ * The monitor keeps the value of each counter at the previous sample as its baseline. If a counter is lower than its
+ * baseline (e.g. it was cleared by a READ_CLEAR of sx_api_port_counter_phy_layer_statistics_get by another user, or
+ * by a port reset), no delta is reported for that counter in the record: the current value becomes the new baseline
+ * and the counter is flagged as re-baselined in the record. The uncorrected count threshold is not evaluated for a
+ * re-baselined sample.
+ *
+ * Note: The monitor samples counters without clearing them and does not affect sx_api_port_ber_monitor_set.
+ * Note: As with sx_api_port_counter_phy_layer_statistics_get, the FEC counters depend on the current FEC mode of the
+ *       port (e.g. corrected blocks for FC FEC and corrected symbols for RS FEC). A FEC mode change re-baselines the
+ *       counters of the port.
+ * Note: It is recommended to first register to SX_TRAP_ID_PORT_PHY_STATS_RECORDS and
+ *       SX_TRAP_ID_PORT_PHY_STATS_THRESHOLD and to then create the monitor.
+ *
+ * Supported devices: Spectrum, Spectrum2, Spectrum3, Spectrum4.
+ *
+ * @param[in] handle          - SX-API handle
+ * @param[in] cmd             - CREATE/EDIT/DESTROY
+ * @param[in] log_port_list_p - List of network ports to monitor
+ * @param[in] port_cnt        - Number of ports (0 for all network ports)
+ * @param[in] monitor_attr_p  - Monitor attributes (sample period, statistics mask, thresholds, records per event)
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL
+ * @return SX_STATUS_PARAM_ERROR if any input parameter is invalid
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if the sample period or records per event are out of range
+ * @return SX_STATUS_ENTRY_ALREADY_EXISTS if CREATE is called when the monitor already exists
+ * @return SX_STATUS_ENTRY_NOT_FOUND if EDIT/DESTROY is called when the monitor does not exist
+ * @return SX_STATUS_CMD_UNSUPPORTED if command is not supported
+ * @return SX_STATUS_ERROR general error
+ */
+sx_status_t sx_api_port_phy_stats_monitor_set(const sx_api_handle_t                   handle,
+                                              const sx_access_cmd_t                   cmd,
+                                              const sx_port_log_id_t                 *log_port_list_p,
+                                              const uint32_t                          port_cnt,
+                                              const sx_port_phy_stats_monitor_attr_t *monitor_attr_p);
+
+/**
+ * This API retrieves the PHY statistics monitor configuration.
+ * If log_port_list_p is NULL, only the number of monitored ports is returned in port_cnt_p.
+ *
+ * Supported devices: Spectrum, Spectrum2, Spectrum3, Spectrum4.
+ *
+ * @param[in] handle              - SX-API handle
+ * @param[out] log_port_list_p    - List of monitored ports
+ * @param[in,out] port_cnt_p      - [in] list length/[out] number of monitored ports
+ * @param[out] monitor_attr_p     - Monitor attributes
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL
+ * @return SX_STATUS_ENTRY_NOT_FOUND if the monitor does not exist
+ * @return SX_STATUS_ERROR general error
+ */
+sx_status_t sx_api_port_phy_stats_monitor_get(const sx_api_handle_t             handle,
+                                              sx_port_log_id_t                 *log_port_list_p,
+                                              uint32_t                         *port_cnt_p,
+                                              sx_port_phy_stats_monitor_attr_t *monitor_attr_p);
+
 /**
  * This API SETs the sll_max_time in microseconds.
  * SLL is the max lifetime of a frame within the switch. The packet will be discarded
@@ -2704,6 +2986,97 @@ sx_status_t sx_api_port_state_event_delay_counter_get(const sx_api_handle_t
                                                       const sx_port_log_id_t                log_port,
                                                       sx_port_state_event_delay_counters_t *cntr_delay_state_p);
 
+/**
+ * This API configures batching of port state change notification events.
+ * When batching is enabled, all ports whose operational state changed within the coalescing window are reported
+ * together in a single SX_TRAP_ID_PORT_STATE_BATCH_EVENT event (receive_info.event_info.port_state_batch), in addition
+ * to the per-port port state change events (PUDE).
+ * The coalescing window is opened by the first state change after the previous batch was sent, and the batch is sent
+ * when the window expires or when the batch holds max_ports_per_event ports, whichever comes first.
+ * Each port in the batch is reported once with its last operational state and two counts for the window:
+ *   - flap_cnt          - The number of operational state changes detected by the hardware, counted before the
+ *                         per-port delay of sx_api_port_state_event_delay_set is applied.
+ *   - filtered_flap_cnt - The number of those changes that were filtered by the per-port delay, i.e. changes after
+ *                         which the port did not remain in the new state for the delay time.
+ * The reported operational state is the state after the per-port delay, i.e. the state reported by PUDE events.
+ * A port whose state changes were all filtered by the delay is still added to the batch, with its unchanged state
+ * and flap_cnt equal to filtered_flap_cnt, so that flaps hidden by the delay remain visible.
+ * The coalescing window can be set in 10 ms granularity, in the range of SX_PORT_STATE_EVENT_BATCH_WINDOW_MIN to
+ * SX_PORT_STATE_EVENT_BATCH_WINDOW_MAX.
+ * Only logical ports of types SX_PORT_TYPE_NETWORK and SX_PORT_TYPE_PROFILE are reported in the batch.
+ *
+ * By default, per-port PUDE events are still sent for every state change. If batch_attr_p->pude_suppress is TRUE, the
+ * SDK stops sending per-port PUDE events for the ports reported in batches. The configuration is system-wide: every
+ * process registered to PUDE events, not only the caller, stops receiving them, so suppression should only be enabled
+ * when all port state listeners in the system consume SX_TRAP_ID_PORT_STATE_BATCH_EVENT.
+ * UNSET disables batching, and per-port PUDE events are sent again if they were suppressed.
+ *
+ * Note: It is recommended to first register to SX_TRAP_ID_PORT_STATE_BATCH_EVENT and to then enable batching.
+ *
+ * Supported devices: Spectrum, Spectrum2, Spectrum3, Spectrum4.
+ *
+ * @param[in]   handle          - SX-API handle
+ * @param[in]   cmd             - SET/UNSET
+ * @param[in]   batch_attr_p    - Port state event batching attributes (coalescing window, max ports per event,
+ *                                PUDE suppression)
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully
+ * @return SX_STATUS_COMM_ERROR if client communication fails
+ * @return SX_STATUS_INVALID_HANDLE if a NULL handle is received
+ * @return SX_STATUS_PARAM_ERROR if an input parameter is invalid
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if the coalescing window or max ports per event are out of range
+ * @return SX_STATUS_CMD_UNSUPPORTED if access command is not supported
+ * @return SX_STATUS_ERROR general error
+ */
+sx_status_t sx_api_port_state_event_batch_set(const sx_api_handle_t                   handle,
+                                              const sx_access_cmd_t                   cmd,
+                                              const sx_port_state_event_batch_attr_t *batch_attr_p);
+
+/**
+ * This API retrieves the port state change notification batching attributes.
+ *
+ * Supported devices: Spectrum, Spectrum2, Spectrum3, Spectrum4.
+ *
+ * @param[in]   handle          - SX-API handle
+ * @param[out]  batch_attr_p    - Port state event batching attributes
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully
+ * @return SX_STATUS_COMM_ERROR if client communication fails
+ * @return SX_STATUS_INVALID_HANDLE if a NULL handle is received
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL
+ * @return SX_STATUS_ENTRY_NOT_FOUND if batching is not configured
+ * @return SX_STATUS_ERROR general error
+ */
+sx_status_t sx_api_port_state_event_batch_get(const sx_api_handle_t             handle,
+                                              sx_port_state_event_batch_attr_t *batch_attr_p);
+
+/**
+ * This API retrieves the port state event batching counters.
+ * The counters hold the number of batch events sent, the number of port state changes reported in them, the number
+ * of those changes that were filtered by the per-port delay, and the number of batches sent because
+ * max_ports_per_event was reached before the coalescing window expired.
+ * The following options are available:
+ * 1. Read the counters (using SX_ACCESS_CMD_READ).
+ * 2. Read and clear the counters (using SX_ACCESS_CMD_READ_CLEAR).
+ *
+ * Supported devices: Spectrum, Spectrum2, Spectrum3, Spectrum4.
+ *
+ * @param[in]   handle          - SX-API handle
+ * @param[in]   cmd             - READ/READ_CLEAR
+ * @param[out]  batch_cntr_p    - Port state event batching counters
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully
+ * @return SX_STATUS_COMM_ERROR if client communication fails
+ * @return SX_STATUS_INVALID_HANDLE if a NULL handle is received
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL
+ * @return SX_STATUS_CMD_UNSUPPORTED if command is not supported
+ * @return SX_STATUS_ERROR general error
+ */
+sx_status_t sx_api_port_state_event_batch_counter_get(const sx_api_handle_t                 handle,
+                                                      const sx_access_cmd_t                 cmd,
+                                                      sx_port_state_event_batch_counters_t *batch_cntr_p);
+
 /**
  *  This API sets the ASIC Parser Attributes.
  *
@@ -3046,6 +3419,90 @@ sx_status_t sx_api_port_ext_params_bulk_get(const sx_api_handle_t      handle,
                                             const sx_port_log_id_t    *log_port_list_p,
                                             sx_port_ext_port_params_t *extended_params_list_p,
                                             const uint32_t             port_cnt);
+
+/**
+ * This API sets administrative attributes for a list of ports in a single call.
+ * Each element of attr_list_p holds the attributes to apply to the matching port in log_port_list_p, and a
+ * valid_attr_mask of SX_PORT_ATTR_BULK_* bits selecting which of the following attributes are applied:
+ *   - MTU, as with sx_api_port_mtu_set
+ *   - Speed, as with sx_api_port_speed_admin_set (Spectrum, Spectrum2, Spectrum3 only)
+ *   - Rate, as with sx_api_port_rate_set (Spectrum2, Spectrum3, Spectrum4 only)
+ *   - PVID, as with sx_api_vlan_port_pvid_set ADD
+ *   - Loopback filter mode, as with sx_api_port_loopback_filter_set (changing the state is not supported on Spectrum)
+ *   - Storm control parameters of a single storm control ID, as with sx_api_port_storm_control_set ADD/EDIT
+ *   - Admin state, as with sx_api_port_state_set
+ * Attributes not selected in valid_attr_mask are left unchanged.
+ * Each attribute is supported on the devices of its per-port API. Selecting an attribute that is not supported on the
+ * device fails the port with SX_STATUS_UNSUPPORTED.
+ *
+ * Hardware writes of all ports are aggregated per register. Within a port, the admin state is applied last, thus a
+ * port set to UP comes up with the rest of its new attributes already configured.
+ * Ports are processed independently, and if a port fails, none of its attributes are applied. In case the operation
+ * fails on one or more ports, an error is returned, log_port_list_p and attr_list_p store those ports and their
+ * attributes and their quantity is stored in port_cnt_p, as with sx_api_fdb_uc_mac_addr_set. The error returned is
+ * the one of the first failed port.
+ * Upon successful completion, SUCCESS is returned and port_cnt_p, log_port_list_p and attr_list_p are unchanged.
+ *
+ * Note: Speed and rate are mutually exclusive per SDK life cycle, as with sx_api_port_speed_admin_set and
+ *       sx_api_port_rate_set. Selecting both for the same port fails that port.
+ * Note: A port may appear only once in log_port_list_p.
+ *
+ * Supported devices: Spectrum, Spectrum2, Spectrum3, Spectrum4 (per attribute, as listed above).
+ *
+ * @param[in] handle              - SX-API handle
+ * @param[in] cmd                 - SET
+ * @param[in,out] log_port_list_p - List of logical ports/failed ports
+ * @param[in,out] attr_list_p     - Attributes to apply to each port/attributes of the failed ports
+ * @param[in,out] port_cnt_p      - Number of logical ports/number of failed ports
+ *
+ * @return SX_STATUS_SUCCESS             if operation completes successfully
+ * @return SX_STATUS_COMM_ERROR          if client communication fails
+ * @return SX_STATUS_INVALID_HANDLE      if a NULL handle is received
+ * @return SX_STATUS_PARAM_ERROR         if an input parameter is invalid
+ * @return SX_STATUS_PARAM_NULL          if a parameter is NULL
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if *port_cnt_p exceeds the number of ports in the system
+ * @return SX_STATUS_ENTRY_NOT_FOUND     if a port is not found in the DB
+ * @return SX_STATUS_UNSUPPORTED         if a selected attribute is not supported on the device
+ * @return SX_STATUS_CMD_UNSUPPORTED     if command is not supported
+ * @return SX_STATUS_ERROR               general error
+ */
+sx_status_t sx_api_port_attr_bulk_set(const sx_api_handle_t  handle,
+                                      const sx_access_cmd_t  cmd,
+                                      sx_port_log_id_t      *log_port_list_p,
+                                      sx_port_attr_bulk_t   *attr_list_p,
+                                      uint32_t              *port_cnt_p);
+
+/**
+ * This API gets administrative attributes for a list of ports.
+ * The attributes selected in valid_attr_mask of each element of attr_list_p are retrieved for the matching port in
+ * log_port_list_p. The storm control ID to retrieve is taken from the element.
+ * Selecting an attribute that is not supported on the device (see sx_api_port_attr_bulk_set) fails the API with
+ * SX_STATUS_UNSUPPORTED.
+ *
+ * Supported devices: Spectrum, Spectrum2, Spectrum3, Spectrum4 (per attribute, as in sx_api_port_attr_bulk_set).
+ *
+ * @param[in] handle          - SX-API handle
+ * @param[in] cmd             - GET
+ * @param[in] log_port_list_p - List of logical ports
+ * @param[in,out] attr_list_p - Attributes of each port
+ * @param[in] port_cnt        - Number of logical ports
+ *
+ * @return SX_STATUS_SUCCESS         if operation completes successfully
+ * @return SX_STATUS_COMM_ERROR      if client communication fails
+ * @return SX_STATUS_INVALID_HANDLE  if a NULL handle is received
+ * @return SX_STATUS_PARAM_ERROR     if an input parameter is invalid
+ * @return SX_STATUS_PARAM_NULL      if a parameter is NULL
+ * @return SX_STATUS_CMD_UNSUPPORTED if command is not supported
+ * @return SX_STATUS_ENTRY_NOT_FOUND if requested element is not found in the DB
+ * @return SX_STATUS_UNSUPPORTED     if a selected attribute is not supported on the device
+ * @return SX_STATUS_ERROR           general error
+ */
+sx_status_t sx_api_port_attr_bulk_get(const sx_api_handle_t   handle,
+                                      const sx_access_cmd_t   cmd,
+                                      const sx_port_log_id_t *log_port_list_p,
+                                      sx_port_attr_bulk_t    *attr_list_p,
+                                      const uint32_t          port_cnt);
+
 /**
  * This API gets the port extended capability parameters.
  *